@@ -0,0 +1,164 @@
+#!/usr/bin/env python3
+"""Compress the web UI sources into flash-resident C arrays.
+
+For each sketch (src/Transmitter, src/Receiver) every file in web/ is gzipped and
+written to <sketch>/web_assets_data.h, which web_assets.cpp serves with
+Content-Encoding: gzip and a strong ETag (hash of the uncompressed file).
+
+Routes:
+  web/index.html  -> /
+  web/<name>.html -> /<name>
+  anything else   -> /a/<stem>.<hash><ext>  (immutable; HTML references to
+                     "/a/<file>" are rewritten to the hashed name)
+
+Run after editing anything under web/ and commit the regenerated headers:
+  python script/build_web_assets.py          # regenerate
+  python script/build_web_assets.py --check  # fail if a header is stale
+"""
+
+import argparse
+import gzip
+import hashlib
+import os
+import sys
+from typing import List, Tuple
+
+ROOT = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), ".."))
+SKETCHES = ["src/Transmitter", "src/Receiver"]
+OUT_NAME = "web_assets_data.h"
+
+MIME = {
+    ".html": "text/html; charset=utf-8",
+    ".css": "text/css; charset=utf-8",
+    ".js": "application/javascript; charset=utf-8",
+    ".json": "application/json",
+    ".svg": "image/svg+xml",
+    ".ico": "image/x-icon",
+    ".png": "image/png",
+}
+
+
+def digest(data: bytes) -> str:
+    return hashlib.sha256(data).hexdigest()
+
+
+def compress(data: bytes) -> bytes:
+    # mtime=0 keeps the output byte-identical between runs
+    return gzip.compress(data, compresslevel=9, mtime=0)
+
+
+def ident(name: str) -> str:
+    return "k_" + "".join(c if c.isalnum() else "_" for c in name)
+
+
+def c_bytes(data: bytes) -> str:
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("    " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    return "\n".join(lines)
+
+
+def collect(web_dir: str) -> List[Tuple[str, str, str, bytes]]:
+    """(file name, route, mime type, content) for every asset, HTML last."""
+    names = sorted(n for n in os.listdir(web_dir) if os.path.isfile(os.path.join(web_dir, n)))
+    for n in names:
+        if os.path.splitext(n)[1] not in MIME:
+            sys.exit("%s: no MIME type for %s" % (web_dir, n))
+
+    assets = []
+    renames = {}
+    for n in names:
+        stem, ext = os.path.splitext(n)
+        if ext == ".html":
+            continue
+        with open(os.path.join(web_dir, n), "rb") as f:
+            data = f.read()
+        route = "/a/%s.%s%s" % (stem, digest(data)[:8], ext)
+        renames[("/a/" + n).encode()] = route.encode()
+        assets.append((n, route, MIME[ext], data))
+
+    for n in names:
+        stem, ext = os.path.splitext(n)
+        if ext != ".html":
+            continue
+        with open(os.path.join(web_dir, n), "rb") as f:
+            data = f.read()
+        for src, dst in renames.items():
+            data = data.replace(b'"' + src + b'"', b'"' + dst + b'"')
+        route = "/" if stem == "index" else "/" + stem
+        assets.append((n, route, MIME[ext], data))
+    return assets
+
+
+def render(sketch: str, assets: List[Tuple[str, str, str, bytes]]) -> str:
+    out = [
+        "// web_assets_data.h",
+        "//",
+        "// GENERATED by script/build_web_assets.py from %s/web/ - do not edit." % sketch,
+        "// Edit the files in web/ and rerun the script.",
+        "",
+        "#pragma once",
+        "",
+        "#include <Arduino.h>",
+        "",
+        '#include "web_assets.h"',
+        "",
+        "namespace WebAssets {",
+        "",
+    ]
+    total_raw = total_gz = 0
+    for name, route, mime, data in assets:
+        gz = compress(data)
+        total_raw += len(data)
+        total_gz += len(gz)
+        out.append("// %s: %d -> %d bytes" % (name, len(data), len(gz)))
+        out.append("static const uint8_t %s[] PROGMEM = {" % ident(name))
+        out.append(c_bytes(gz))
+        out.append("};")
+        out.append("")
+
+    out.append("static const Asset kAssets[] = {")
+    for name, route, mime, data in assets:
+        immutable = "false" if name.endswith(".html") else "true"
+        out.append('    {"%s", "%s", %s, sizeof(%s), "\\"%s\\"", %s},'
+                   % (route, mime, ident(name), ident(name), digest(data)[:16], immutable))
+    out.append("};")
+    out.append("")
+    out.append("// %d files, %d bytes, %d gzipped" % (len(assets), total_raw, total_gz))
+    out.append("")
+    out.append("} // namespace WebAssets")
+    out.append("")
+    return "\n".join(out)
+
+
+def main() -> int:
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("--check", action="store_true", help="only verify the headers are current")
+    args = ap.parse_args()
+
+    stale = False
+    for sketch in SKETCHES:
+        web_dir = os.path.join(ROOT, sketch, "web")
+        if not os.path.isdir(web_dir):
+            continue
+        text = render(sketch, collect(web_dir))
+        path = os.path.join(ROOT, sketch, OUT_NAME)
+        old = None
+        if os.path.exists(path):
+            with open(path, "r", encoding="utf-8") as f:
+                old = f.read()
+        if old == text:
+            print("%s: up to date" % os.path.relpath(path, ROOT))
+            continue
+        if args.check:
+            print("%s: stale, run script/build_web_assets.py" % os.path.relpath(path, ROOT))
+            stale = True
+            continue
+        with open(path, "w", encoding="utf-8", newline="\n") as f:
+            f.write(text)
+        print("%s: written" % os.path.relpath(path, ROOT))
+    return 1 if stale else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
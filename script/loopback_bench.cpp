@@ -0,0 +1,280 @@
+// loopback_bench.cpp
+//
+// Host check and benchmark of the Transmitter -> Receiver frame path, with no ESP32 and
+// no network: two paired FrameTransport::LoopbackLink endpoints carry bin1 packets.
+// The sender follows net_egress (encodeDelta against the previous frame with a RowDict,
+// encodeFull for the first frame, every kKeyEvery frames and on TYPE_KEYREQ; only a
+// resync clears the dictionary). The receiver follows the Receiver sketch (parse,
+// decodeFull / applyDelta, TYPE_KEYREQ back over the link when it loses the chain).
+// Every frame the receiver applies must equal the one sent with that seq; a mismatch
+// exits 1. With loss, dropped packets exercise the gap / keyframe-request path.
+//
+// Build and run from the repository root:
+//   g++ -std=c++17 -O2 -Wall -Isrc/Transmitter -o loopback_bench script/loopback_bench.cpp
+//       src/Transmitter/lcd_frame.cpp src/Transmitter/frame_transport.cpp   (one line)
+//   ./loopback_bench [frames=200000] [loss_pct=0]
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+
+#include "lcd_frame.h"
+#include "frame_transport.h"
+
+using namespace LCDFrame;
+using FrameTransport::Endpoint;
+using FrameTransport::LoopbackLink;
+
+namespace {
+
+    static constexpr uint32_t kKeyEvery = 40;     // frames between periodic keyframes
+
+    uint32_t rng_state = 0x12345678;
+    uint32_t rnd() {
+        rng_state ^= rng_state << 13;
+        rng_state ^= rng_state >> 17;
+        rng_state ^= rng_state << 5;
+        return rng_state;
+    }
+
+    // A dashboard-like screen sequence: menus the user flips between (dictionary hits),
+    // a scrolling ticker (shifts), a changing counter (spans) and cursor/flag changes
+    struct ScreenGen {
+        static constexpr int kScreens = 6;
+        char screens[kScreens][kRows][kCols + 1];
+        const char* ticker = "  Theia OLED emulator - loopback benchmark -  ";
+        size_t ticker_pos = 0;
+        int cur = 0;
+        uint32_t counter = 0;
+        Frame f;
+
+        ScreenGen() {
+            for (int s = 0; s < kScreens; ++s) {
+                for (int r = 0; r < kRows; ++r) {
+                    char text[kCols + 1];
+                    snprintf(text, sizeof(text), "Menu %d item %d", s, r);
+                    snprintf(screens[s][r], sizeof(screens[s][r]), "%-20s", text);
+                }
+            }
+            load();
+        }
+
+        void load() {
+            for (int r = 0; r < kRows; ++r) memcpy(f.rows[r], screens[cur][r], kCols + 1);
+        }
+
+        const Frame& next() {
+            const uint32_t pick = rnd() % 100;
+            if (pick < 10) {
+                cur = (int)(rnd() % kScreens);
+                load();
+            } else if (pick < 55) {
+                // Ticker on the bottom row, one cell per frame
+                const size_t n = strlen(ticker);
+                ticker_pos = (ticker_pos + 1) % n;
+                for (int c = 0; c < kCols; ++c) f.rows[kRows - 1][c] = ticker[(ticker_pos + c) % n];
+            } else if (pick < 85) {
+                char num[8];
+                snprintf(num, sizeof(num), "%05u", (unsigned)(counter++ % 100000));
+                memcpy(&f.rows[1][14], num, 5);
+            } else if (pick < 95) {
+                f.cursor_row = (uint8_t)(rnd() % kRows);
+                f.cursor_col = (uint8_t)(rnd() % kCols);
+            } else {
+                f.cursor_on = !f.cursor_on;
+                f.blink_on = (rnd() & 1) != 0;
+            }
+            return f;
+        }
+    };
+
+    bool sameFrame(const Frame& a, const Frame& b) {
+        for (int r = 0; r < kRows; ++r) {
+            if (memcmp(a.rows[r], b.rows[r], kCols) != 0) return false;
+        }
+        return a.cursor_row == b.cursor_row && a.cursor_col == b.cursor_col &&
+               a.display_on == b.display_on && a.cursor_on == b.cursor_on && a.blink_on == b.blink_on;
+    }
+
+    struct Sender {
+        LoopbackLink link{1};
+        RowDict dict;
+        Frame base;
+        uint16_t seq = 0;
+        bool have_base = false;
+        bool key_requested = false;
+        uint32_t since_key = 0;
+        uint32_t loss_pct = 0;
+
+        uint64_t bytes = 0;
+        uint32_t keys = 0, deltas = 0, shift_rows = 0, dict_rows = 0, lost = 0, keyreqs = 0;
+
+        void send(const Frame& f) {
+            uint8_t buf[kMaxPacket];
+            const uint16_t next = (uint16_t)(seq + 1);
+            const bool resync = !have_base || key_requested;
+            const bool key = resync || since_key >= kKeyEvery;
+            DeltaInfo info;
+            size_t len = key ? 0 : encodeDelta(buf, sizeof(buf), next, seq, base, f, &info, &dict);
+            if (len) {
+                deltas++;
+                shift_rows += info.shift_rows;
+                dict_rows += info.dict_rows;
+            } else {
+                if (resync) dictClear(dict);
+                len = encodeFull(buf, sizeof(buf), next, f);
+                since_key = 0;
+                key_requested = false;
+                keys++;
+            }
+            seq = next;
+            base = f;
+            have_base = true;
+            dictLearn(dict, f);
+            since_key++;
+            bytes += len;
+            if (loss_pct && rnd() % 100 < loss_pct) {
+                lost++;
+                return;
+            }
+            if (!link.broadcast(buf, len)) {
+                fprintf(stderr, "loopback send failed (seq %u)\n", (unsigned)next);
+                exit(1);
+            }
+        }
+
+        void poll() {
+            uint8_t buf[kMaxPacket];
+            Endpoint from;
+            size_t len;
+            while ((len = link.receive(buf, sizeof(buf), from)) > 0) {
+                Packet p;
+                if (parse(buf, len, p) == Result::Ok && p.type == TYPE_KEYREQ) {
+                    key_requested = true;
+                    keyreqs++;
+                }
+            }
+        }
+    };
+
+    struct Receiver {
+        LoopbackLink link{2};
+        RowDict dict;
+        Frame frame;
+        uint16_t seq = 0;
+        bool have_base = false;
+        bool asked = false;         // one TYPE_KEYREQ per lost chain
+
+        uint32_t applied = 0, gaps = 0, dict_misses = 0, rejected = 0;
+
+        void askKey() {
+            have_base = false;
+            if (asked) return;
+            asked = true;
+            uint8_t buf[kMaxPacket];
+            const size_t len = encodeKeyRequest(buf, sizeof(buf), seq);
+            link.broadcast(buf, len);
+        }
+
+        // True when a packet was applied
+        bool poll() {
+            uint8_t buf[kMaxPacket];
+            Endpoint from;
+            bool got = false;
+            size_t len;
+            while ((len = link.receive(buf, sizeof(buf), from)) > 0) {
+                Packet p;
+                if (parse(buf, len, p) != Result::Ok) {
+                    rejected++;
+                    continue;
+                }
+                if (p.type == TYPE_FULL) {
+                    if (decodeFull(p, frame) != Result::Ok) {
+                        rejected++;
+                        continue;
+                    }
+                    // The sender clears its dictionary on the keyframe that resyncs us
+                    if (!have_base) dictClear(dict);
+                } else if (p.type == TYPE_DELTA) {
+                    if (!have_base || deltaBase(p) != seq) {
+                        gaps++;
+                        askKey();
+                        continue;
+                    }
+                    const Result res = applyDelta(p, frame, &dict);
+                    if (res == Result::UnknownRow) {
+                        dict_misses++;
+                        askKey();
+                        continue;
+                    }
+                    if (res != Result::Ok) {
+                        rejected++;
+                        have_base = false;
+                        continue;
+                    }
+                } else {
+                    continue;
+                }
+                dictLearn(dict, frame);
+                seq = p.seq;
+                have_base = true;
+                asked = false;
+                applied++;
+                got = true;
+            }
+            return got;
+        }
+    };
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const uint32_t frames = argc > 1 ? (uint32_t)strtoul(argv[1], nullptr, 10) : 200000;
+    const uint32_t loss = argc > 2 ? (uint32_t)strtoul(argv[2], nullptr, 10) : 0;
+
+    static Sender tx;
+    static Receiver rx;
+    tx.loss_pct = loss;
+    LoopbackLink::pair(tx.link, rx.link);
+    tx.link.begin();
+    rx.link.begin();
+
+    ScreenGen gen;
+    uint32_t verified = 0;
+    const auto t0 = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < frames; ++i) {
+        const Frame& f = gen.next();
+        tx.poll();
+        tx.send(f);
+        if (rx.poll() && rx.seq == tx.seq) {
+            if (!sameFrame(rx.frame, f)) {
+                fprintf(stderr, "MISMATCH at frame %u (seq %u)\n", (unsigned)i, (unsigned)tx.seq);
+                for (int r = 0; r < kRows; ++r) {
+                    fprintf(stderr, "  sent \"%.20s\"  got \"%.20s\"\n", f.rows[r], rx.frame.rows[r]);
+                }
+                return 1;
+            }
+            verified++;
+        }
+    }
+    const double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+    printf("frames      %u (loss %u%%)\n", (unsigned)frames, (unsigned)loss);
+    printf("keyframes   %u  deltas %u  (shift rows %u, dict rows %u)\n",
+           (unsigned)tx.keys, (unsigned)tx.deltas, (unsigned)tx.shift_rows, (unsigned)tx.dict_rows);
+    printf("bytes/frame %.1f\n", frames ? (double)tx.bytes / frames : 0.0);
+    printf("lost        %u  gaps %u  dict misses %u  keyreqs %u  rejected %u\n",
+           (unsigned)tx.lost, (unsigned)rx.gaps, (unsigned)rx.dict_misses, (unsigned)tx.keyreqs,
+           (unsigned)rx.rejected);
+    printf("verified    %u / %u applied\n", (unsigned)verified, (unsigned)rx.applied);
+    printf("throughput  %.0f frames/s (%.2f us/frame)\n", frames / secs, secs * 1e6 / frames);
+
+    if (rx.rejected || verified != rx.applied || (loss == 0 && verified != frames)) {
+        fprintf(stderr, "FAILED\n");
+        return 1;
+    }
+    printf("OK\n");
+    return 0;
+}
@@ -3,6 +3,7 @@
 import json
 import socket
 import threading
+import time
 import sys
 import os
 from typing import List, Optional
@@ -26,8 +27,37 @@ from PySide6.QtWidgets import (
 )
 
 UDP_PORT = 35182
+MCAST_GROUP = "239.255.76.67"
 INI_NAME = "lcd_viewer.ini"
 
+# Subscription control packets (lcd_frame.h). Subscribing gets us the frames unicast
+# instead of relying on the broadcast, which the Transmitter sends only while nobody is
+# subscribed (plus a beacon every couple of seconds).
+FRAME_MAGIC = b"\xA7\x4C"
+FRAME_VERSION = 1
+TYPE_JOIN = 0x12
+TYPE_LEAVE = 0x13
+TYPE_ALIVE = 0x14
+FMT_JSON = 0x01
+ALIVE_INTERVAL_S = 5.0
+
+
+def _crc16(data: bytes) -> int:
+    # CRC-16/CCITT-FALSE
+    crc = 0xFFFF
+    for b in data:
+        crc ^= b << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+
+def _control_packet(ptype: int, payload: bytes = b"") -> bytes:
+    pkt = FRAME_MAGIC + bytes([FRAME_VERSION, ptype, 0, 0, 0, 0]) + payload
+    crc = _crc16(pkt)
+    return pkt + bytes([crc & 0xFF, crc >> 8])
+
 
 # ---------- Worker: UDP receiver on a background thread ----------
 class UdpReceiver(QObject):
@@ -51,13 +81,24 @@ class UdpReceiver(QObject):
 
     def _run(self):
         sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+        sub_addr = None      # Transmitter we subscribed to
+        last_alive = 0.0
         try:
             sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
             sock.bind(("", self._port))
+            try:
+                # Transmitter in multicast mode (/lcd/transport); broadcast still arrives too
+                mreq = socket.inet_aton(MCAST_GROUP) + socket.inet_aton("0.0.0.0")
+                sock.setsockopt(socket.IPPROTO_IP, socket.IP_ADD_MEMBERSHIP, mreq)
+            except OSError:
+                pass
             while not self._stop:
+                if sub_addr is not None and time.monotonic() - last_alive >= ALIVE_INTERVAL_S:
+                    sock.sendto(_control_packet(TYPE_ALIVE, bytes([FMT_JSON])), sub_addr)
+                    last_alive = time.monotonic()
                 try:
                     sock.settimeout(0.25)
-                    data, _addr = sock.recvfrom(4096)
+                    data, addr = sock.recvfrom(4096)
                 except socket.timeout:
                     continue
                 except OSError:
@@ -65,15 +106,26 @@ class UdpReceiver(QObject):
 
                 try:
                     msg = json.loads(data.decode("utf-8"))
-                except json.JSONDecodeError:
+                except (json.JSONDecodeError, UnicodeDecodeError):
+                    # Binary LCD frames (lcd_frame.h) share the port; they are not for us
                     continue
 
                 if isinstance(msg, dict) and msg.get("type") == "lcd20x4":
+                    if msg.get("hop", 0) > 0:
+                        # A panel's telemetry mirror of a frame we get first-hand anyway
+                        continue
+                    if sub_addr is None and "fmt" in msg:
+                        # The control channel is always on UDP_PORT, whatever the source port
+                        sub_addr = (addr[0], self._port)
+                        sock.sendto(_control_packet(TYPE_JOIN, bytes([FMT_JSON])), sub_addr)
+                        last_alive = time.monotonic()
                     self.packet.emit(msg)
         except Exception as e:
             self.packet.emit({"type": "error", "error": str(e)})
         finally:
             try:
+                if sub_addr is not None:
+                    sock.sendto(_control_packet(TYPE_LEAVE), sub_addr)
                 sock.close()
             except Exception:
                 pass
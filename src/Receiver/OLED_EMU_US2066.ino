@@ -1,12 +1,14 @@
 #include <Arduino.h>
 #include <Wire.h>
-#include <WiFiUdp.h>
 #include <ArduinoJson.h>
 #include <ESPmDNS.h>
 #include <WiFi.h>
+#include <Preferences.h>
 #include "wifimgr.h"     
 #include "led_stat.h"    
 #include "us2066.h"      
+#include "lcd_frame.h"
+#include "frame_transport.h"
 
 // ---------------- Constants (local) ----------------
 static const uint16_t LCD_RX_UDP_PORT = 35182;
@@ -44,6 +46,12 @@ struct LCD20x4State {
 static LCD20x4State g_state;
 static bool         g_haveData = false;
 
+// What is currently on the glass, so live updates only write the cells that changed.
+// A scrolling marquee row then costs one row burst per step instead of a full repaint.
+static LCD20x4State g_panel;
+static bool         g_panelValid = false;
+static uint32_t     g_i2cCellsWritten = 0;
+
 // ---------------- Pages / UI ----------------
 enum class Page : uint8_t { Splash=0, Live=1, Info=2 };
 static Page currentPage = Page::Splash;
@@ -53,12 +61,96 @@ static const uint32_t INFO_DURATION_MS = 10000;
 static uint32_t lastInfoShownMs = 0;
 static uint32_t infoStartMs     = 0;
 
-static WiFiUDP g_udp;
-static bool    g_udpBegun   = false;
+static FrameTransport::UdpLink g_udp(LCD_RX_UDP_PORT);
 static bool    g_mdnsReady  = false;
 
+// ESP-NOW (frame_transport.h): with /rx/espnow?on=1 (persisted) the Receiver also listens on
+// ESP-NOW and broadcasts TYPE_JOIN there; a Transmitter with ESP-NOW on answers and the
+// subscription moves to it, skipping the AP. Both boards must be on the same WiFi channel.
+// Without an answer within ESPNOW_GRACE_MS we subscribe over UDP as before.
+#ifndef LCD_RX_ESPNOW
+#define LCD_RX_ESPNOW 0
+#endif
+static FrameTransport::EspNowLink g_espnow;
+static volatile bool g_espnowEnabled = LCD_RX_ESPNOW;
+static uint32_t g_espnowTryMs  = 0;
+static uint32_t g_espnowUpMs   = 0;
+static uint32_t g_espnowJoinMs = 0;
+static const uint32_t ESPNOW_JOIN_MS  = 2000;
+static const uint32_t ESPNOW_GRACE_MS = 3000;
+
+// Source ID ("src" of our telemetry) and frames dropped as feedback loops: our own
+// broadcasts, and mirrors ("hop" > 0, FLAG_MIRROR) other devices re-sent
+static char     g_deviceId[13] = "";
+static uint32_t g_dropSelf     = 0;
+static uint32_t g_dropMirror   = 0;
+
+// Link and sender of the packet being handled
+static FrameTransport::Link*    g_rxLink = &g_udp;
+static FrameTransport::Endpoint g_rxFrom;
+
+// Multicast group the Transmitter sends to in multicast mode (/lcd/transport). The socket
+// joins it (IGMP) on every connect and still receives broadcast and unicast on the port.
+// /rx/mcast?group=a.b.c.d changes it (persisted); group=off stops joining.
+#ifndef LCD_RX_MCAST_GROUP
+#define LCD_RX_MCAST_GROUP "239.255.76.67"
+#endif
+static IPAddress g_mcastGroup;                     // 0.0.0.0 = do not join
+static bool      g_wasConnected   = false;
+static volatile bool     g_mcastChanged = false;   // set by /rx/mcast, applied by loop()
+static volatile uint32_t g_mcastNew     = 0;
+
 volatile uint32_t g_udpPacketCount = 0;
 
+// ---------------- Binary stream (lcd_frame.h) ----------------
+// The Transmitter advertises "fmt":["json","bin1"] in its JSON frames. We subscribe with
+// TYPE_JOIN and it starts unicasting binary frames to us; TYPE_ALIVE keeps the subscription
+// open. While binary flows, the sender's JSON beacon broadcast is dropped without parsing.
+// Deltas are only applied on top of the exact frame they name; after a gap we ask for a
+// keyframe and accept the sender's JSON frames until one arrives.
+static const uint32_t ALIVE_INTERVAL_MS = 5000;   // sender forgets us after ~15 s of silence
+static const uint32_t SUB_TIMEOUT_MS    = 30000;  // sender silent this long: stop, rejoin on its beacon
+static const uint32_t BIN_ACTIVE_MS     = 3000;   // binary considered flowing for this long
+static const uint32_t KEYREQ_RETRY_MS   = 250;
+static const uint8_t  RX_FORMATS        = LCDFrame::FMT_JSON | LCDFrame::FMT_BIN1;
+static bool      g_subscribed  = false;
+static FrameTransport::Link*    g_subLink = &g_udp;
+static FrameTransport::Endpoint g_subSource;   // Transmitter we are subscribed to (control endpoint)
+static uint32_t  g_lastSubRxMs = 0;      // last packet from g_subSource
+static uint32_t  g_lastAliveMs = 0;
+static uint32_t  g_joins       = 0;
+static FrameTransport::Link*    g_binLink = &g_udp;
+static FrameTransport::Endpoint g_binSource;
+static uint32_t  g_lastBinMs   = 0;
+static bool      g_binSeen     = false;
+static uint16_t  g_binSeq      = 0;     // seq of g_binFrame
+static LCDFrame::Frame g_binFrame;     // base the next delta must apply to
+static LCDFrame::RowDict g_binDict;    // mirror of the sender's row dictionary
+static bool      g_binHaveBase = false;
+static uint32_t  g_lastKeyReqMs = 0;
+static uint32_t  g_binDeltas   = 0;
+static uint32_t  g_binGaps     = 0;   // deltas that did not match our base (loss/reorder)
+static uint32_t  g_keyReqs     = 0;
+static uint32_t  g_binFrames   = 0;
+static uint32_t  g_binRejected = 0;   // bad CRC/version/payload
+static uint32_t  g_dictMisses  = 0;   // deltas naming a row our dictionary lacks
+
+// Loss feedback for the sender's rate control: binary frames applied vs. the seq range
+// covered since the last TYPE_ALIVE
+static uint16_t  g_lossSeq0    = 0;
+static uint32_t  g_lossApplied = 0;
+static bool      g_lossValid   = false;
+static uint8_t   g_lossPct     = LCDFrame::kLossUnknown;   // last value reported
+
+// FEC: with /lcd/schedule?fec=<ms> the sender repeats every frame (JSON "rep":true, binary
+// FLAG_REPEAT). A repeat we use replaces a lost original; one we already have is dropped.
+static uint32_t  g_fecRecovered     = 0;
+static uint32_t  g_fecDuplicates    = 0;
+static uint32_t  g_fecUnrecoverable = 0;   // binary frames lost with their repeat (seq gaps)
+static uint32_t  g_jsonGen          = 0;   // "gen" of the last JSON frame applied
+static bool      g_jsonGenValid     = false;
+static uint32_t  g_jsonSkipped = 0;   // JSON duplicates not parsed because binary is active
+
 static inline String fit20(const String& s) {
   if (s.length() >= 20) return s.substring(0, 20);
   String out(s);
@@ -75,10 +167,46 @@ static String uptimeHMS(uint32_t ms) {
   return String(buf);
 }
 
+static void load_mcast_group() {
+  Preferences prefs;
+  prefs.begin("rx", true);
+  const String group = prefs.getString("mcast", LCD_RX_MCAST_GROUP);
+  prefs.end();
+  if (group == "off" || !g_mcastGroup.fromString(group)) g_mcastGroup = IPAddress((uint32_t)0);
+}
+
+static void load_espnow() {
+  Preferences prefs;
+  prefs.begin("rx", true);
+  g_espnowEnabled = prefs.getBool("espnow", LCD_RX_ESPNOW);
+  prefs.end();
+}
+
+// Bind the port; on every (re)connect or group change re-bind it with an IGMP join
 static void ensureUdp() {
-  if (!g_udpBegun) {
-    g_udp.begin(LCD_RX_UDP_PORT);
-    g_udpBegun = true;
+  const bool connected = WiFiMgr::isConnected();
+  if (g_mcastChanged) {
+    g_mcastChanged = false;
+    g_mcastGroup = IPAddress((uint32_t)g_mcastNew);
+    g_udp.end();
+  } else if (connected && !g_wasConnected && (uint32_t)g_mcastGroup != 0) {
+    g_udp.end();
+  }
+  g_wasConnected = connected;
+
+  if (!g_udp.ready()) {
+    g_udp.setJoinGroup(connected ? g_mcastGroup : IPAddress((uint32_t)0));
+    g_udp.begin();
+  }
+}
+
+static void ensureEspNow(uint32_t now) {
+  if (g_espnowEnabled && !g_espnow.ready() && now - g_espnowTryMs >= 1000) {
+    g_espnowTryMs = now;
+    if (g_espnow.begin()) g_espnowUpMs = now;
+  } else if (!g_espnowEnabled && g_espnow.ready()) {
+    if (g_subLink == &g_espnow) g_subscribed = false;
+    g_espnow.end();
   }
 }
 
@@ -93,14 +221,35 @@ static void ensureMdns() {
   }
 }
 
-static bool parse_lcd20x4(const String& payload, LCD20x4State& out) {
+// Transport fields of a JSON frame (not part of the display state)
+struct JsonMeta {
+  bool offers_bin = false;   // "fmt" lists bin1
+  bool repeat = false;       // "rep": FEC repeat
+  uint32_t gen = 0;
+  char src[16] = "";         // "src": sending device
+  uint8_t hop = 0;           // "hop": 0 = from the I2C bus, > 0 = mirror
+};
+
+static bool parse_lcd20x4(const uint8_t* payload, size_t len, LCD20x4State& out, JsonMeta* meta) {
   StaticJsonDocument<1024> doc;
-  DeserializationError err = deserializeJson(doc, payload);
+  DeserializationError err = deserializeJson(doc, (const char*)payload, len);
   if (err) return false;
 
   const char* type = doc["type"] | "";
   if (strcmp(type, "lcd20x4") != 0) return false;
 
+  if (meta) {
+    *meta = JsonMeta();
+    JsonArray fmt = doc["fmt"];
+    for (size_t i = 0; i < fmt.size(); ++i) {
+      if (strcmp(fmt[i] | "", "bin1") == 0) meta->offers_bin = true;
+    }
+    meta->repeat = doc["rep"] | false;
+    meta->gen = doc["gen"] | 0u;
+    snprintf(meta->src, sizeof(meta->src), "%s", doc["src"] | "");
+    meta->hop = doc["hop"] | 0;
+  }
+
   out.display_on = doc["disp"]  | true;
   out.cursor_on  = doc["cur"]   | false;
   out.blink_on   = doc["blink"] | false;
@@ -128,7 +277,172 @@ static bool parse_lcd20x4(const String& payload, LCD20x4State& out) {
   return true;
 }
 
+// Where control packets for a sender go. A UDP Transmitter listens on LCD_RX_UDP_PORT
+// whatever port its frames come from (multicast leaves from another).
+static FrameTransport::Endpoint control_endpoint(FrameTransport::Link* link, FrameTransport::Endpoint ep) {
+  if (link == &g_udp) ep.port = LCD_RX_UDP_PORT;
+  return ep;
+}
+
+static void send_control(FrameTransport::Link* link, const FrameTransport::Endpoint& to, const uint8_t* buf, size_t n) {
+  link->sendTo(to, buf, n);
+}
+
+static void send_keyreq() {
+  uint8_t buf[16];
+  const size_t n = LCDFrame::encodeKeyRequest(buf, sizeof(buf), g_binSeq);
+  send_control(g_rxLink, control_endpoint(g_rxLink, g_rxFrom), buf, n);
+  g_keyReqs++;
+}
+
+// Binary keyframe/delta -> state. Returns false for anything that does not yield a new frame.
+static bool parse_binary(const uint8_t* payload, size_t len, LCD20x4State& out) {
+  LCDFrame::Packet pkt;
+  if (LCDFrame::parse(payload, len, pkt) != LCDFrame::Result::Ok ||
+      (pkt.type != LCDFrame::TYPE_FULL && pkt.type != LCDFrame::TYPE_DELTA)) {
+    g_binRejected++;
+    return false;
+  }
+  if (pkt.flags & LCDFrame::FLAG_MIRROR) {
+    g_dropMirror++;
+    return false;
+  }
+
+  // Drop duplicates and late (reordered) frames; a long silence means the sender restarted
+  const uint32_t now = millis();
+  const bool fresh = !g_binSeen || (now - g_lastBinMs) >= BIN_ACTIVE_MS;
+  const bool repeat = (pkt.flags & LCDFrame::FLAG_REPEAT) != 0;
+  if (!fresh && (int16_t)(pkt.seq - g_binSeq) <= 0) {
+    if (repeat) g_fecDuplicates++;
+    return false;
+  }
+  if (fresh) g_lossValid = false;      // seq restarted; the next keep-alive starts a window
+  g_binSeen = true;
+  g_lastBinMs = now;
+  g_binLink   = g_rxLink;
+  g_binSource = g_rxFrom;
+
+  if (pkt.type == LCDFrame::TYPE_FULL) {
+    if (LCDFrame::decodeFull(pkt, g_binFrame) != LCDFrame::Result::Ok) {
+      g_binRejected++;
+      return false;
+    }
+    // The sender clears its dictionary on the keyframe that resyncs us; start over with it
+    if (!g_binHaveBase || fresh) LCDFrame::dictClear(g_binDict);
+    else g_fecUnrecoverable += (uint16_t)(pkt.seq - g_binSeq - 1);
+  } else {
+    if (!g_binHaveBase || LCDFrame::deltaBase(pkt) != g_binSeq) {
+      // Missed the frame this delta builds on: wait for a keyframe, nudging the sender
+      g_binGaps++;
+      if (g_binHaveBase) g_fecUnrecoverable += (uint16_t)(LCDFrame::deltaBase(pkt) - g_binSeq);
+      g_binHaveBase = false;
+      if (now - g_lastKeyReqMs >= KEYREQ_RETRY_MS) {
+        g_lastKeyReqMs = now;
+        send_keyreq();
+      }
+      return false;
+    }
+    const LCDFrame::Result res = LCDFrame::applyDelta(pkt, g_binFrame, &g_binDict);
+    if (res == LCDFrame::Result::UnknownRow) {
+      // Our dictionary drifted from the sender's (we resynced on a periodic keyframe)
+      g_dictMisses++;
+      g_binHaveBase = false;
+      if (now - g_lastKeyReqMs >= KEYREQ_RETRY_MS) {
+        g_lastKeyReqMs = now;
+        send_keyreq();
+      }
+      return false;
+    }
+    if (res != LCDFrame::Result::Ok) {
+      g_binRejected++;
+      g_binHaveBase = false;
+      return false;
+    }
+    g_binDeltas++;
+  }
+  LCDFrame::dictLearn(g_binDict, g_binFrame);
+  g_binSeq = pkt.seq;
+  g_binHaveBase = true;
+  g_binFrames++;
+  g_lossApplied++;
+  if (repeat) g_fecRecovered++;
+
+  out.display_on = g_binFrame.display_on;
+  out.cursor_on  = g_binFrame.cursor_on;
+  out.blink_on   = g_binFrame.blink_on;
+  out.cursor_row = g_binFrame.cursor_row;
+  out.cursor_col = g_binFrame.cursor_col;
+  memcpy(out.rows, g_binFrame.rows, sizeof(out.rows));
+  out.last_update_ms = now;
+  out.initialized    = true;
+  return true;
+}
+
+// Subscribe to the Transmitter that sent the current packet
+static void send_join() {
+  uint8_t buf[16];
+  g_subLink   = g_rxLink;
+  g_subSource = control_endpoint(g_rxLink, g_rxFrom);
+  send_control(g_subLink, g_subSource, buf, LCDFrame::encodeJoin(buf, sizeof(buf), RX_FORMATS));
+  g_subscribed  = true;
+  g_lastSubRxMs = g_lastAliveMs = millis();
+  g_joins++;
+}
+
+// A Transmitter answered our ESP-NOW join: move the subscription over from UDP
+static void adopt_espnow(const FrameTransport::Endpoint& from) {
+  uint8_t buf[16];
+  if (g_subscribed && g_subLink != &g_espnow) {
+    send_control(g_subLink, g_subSource, buf, LCDFrame::encodeLeave(buf, sizeof(buf)));
+  }
+  g_subLink     = &g_espnow;
+  g_subSource   = from;
+  g_subscribed  = true;
+  g_lastSubRxMs = g_lastAliveMs = millis();
+  g_joins++;
+}
+
+// Percent of binary frames lost since the previous call (kLossUnknown without binary)
+static uint8_t take_loss_pct(uint32_t now) {
+  const bool active = g_binSeen && (now - g_lastBinMs) < BIN_ACTIVE_MS;
+  uint8_t pct = LCDFrame::kLossUnknown;
+  const uint16_t expected = (uint16_t)(g_binSeq - g_lossSeq0);
+  if (active && g_lossValid && expected > 0) {
+    const uint32_t got = min<uint32_t>(g_lossApplied, expected);
+    pct = (uint8_t)((expected - got) * 100 / expected);
+  } else if (active && g_lossValid) {
+    pct = 0;
+  }
+  g_lossSeq0    = g_binSeq;
+  g_lossApplied = 0;
+  g_lossValid   = active && g_binHaveBase;
+  return pct;
+}
+
+// Keep the subscription alive; give it up once the Transmitter has gone quiet. With
+// ESP-NOW up, keep offering a join there until a Transmitter takes it.
+static void service_subscription(uint32_t now) {
+  if (g_espnow.ready() && !(g_subscribed && g_subLink == &g_espnow) &&
+      now - g_espnowJoinMs >= ESPNOW_JOIN_MS) {
+    g_espnowJoinMs = now;
+    uint8_t buf[16];
+    g_espnow.broadcast(buf, LCDFrame::encodeJoin(buf, sizeof(buf), RX_FORMATS));
+  }
+  if (!g_subscribed) return;
+  if (now - g_lastSubRxMs >= SUB_TIMEOUT_MS) {
+    g_subscribed = false;
+    return;
+  }
+  if (now - g_lastAliveMs >= ALIVE_INTERVAL_MS) {
+    g_lastAliveMs = now;
+    uint8_t buf[16];
+    g_lossPct = take_loss_pct(now);
+    send_control(g_subLink, g_subSource, buf, LCDFrame::encodeAlive(buf, sizeof(buf), RX_FORMATS, g_lossPct));
+  }
+}
+
 static void draw_splash() {
+  g_panelValid = false;
   lcd.displayOn(false, false);
   lcd.clear();
   lcd.writeRow(0, THEIA_BRAND_LINE);
@@ -144,11 +458,39 @@ static void draw_splash() {
 }
 
 static void draw_live(const LCD20x4State& st) {
-  lcd.displayOn(st.cursor_on, st.blink_on);
-  for (int i = 0; i < 4; ++i) lcd.writeRow(i, st.rows[i]);
+  if (!g_panelValid || g_panel.cursor_on != st.cursor_on || g_panel.blink_on != st.blink_on) {
+    lcd.displayOn(st.cursor_on, st.blink_on);
+  }
+
+  for (uint8_t r = 0; r < 4; ++r) {
+    if (!g_panelValid) {
+      lcd.writeRow(r, st.rows[r]);
+      g_i2cCellsWritten += 20;
+      continue;
+    }
+    // Changed runs; gaps shorter than a DDRAM address command are written through
+    uint8_t c = 0;
+    while (c < 20) {
+      if (st.rows[r][c] == g_panel.rows[r][c]) { ++c; continue; }
+      uint8_t end = c + 1;
+      for (uint8_t k = end; k < 20; ++k) {
+        if (st.rows[r][k] != g_panel.rows[r][k]) {
+          if (k - end <= 2) end = k + 1;
+          else break;
+        }
+      }
+      lcd.writeSpan(r, c, &st.rows[r][c], end - c);
+      g_i2cCellsWritten += end - c;
+      c = end;
+    }
+  }
+
+  g_panel = st;
+  g_panelValid = true;
 }
 
 static void draw_theia_info_page() {
+  g_panelValid = false;
   lcd.writeRow(0, fit20(THEIA_BRAND_LINE));
   lcd.writeRow(1, fit20(String("FW ") + FIRMWARE_VERSION));
 
@@ -178,15 +520,89 @@ static void draw_theia_info_page() {
   lcd.writeRow(3, fit20(l3));
 }
 
+static void register_stats_endpoint() {
+  WiFiMgr::getServer().on("/rx/stats", HTTP_GET, [](AsyncWebServerRequest* request){
+    char source[24];
+    g_subLink->format(g_subSource, source, sizeof(source));
+    char j[768];
+    snprintf(j, sizeof(j),
+             "{\"id\":\"%s\",\"packets\":%u,\"bin\":{\"frames\":%u,\"deltas\":%u,\"gaps\":%u,\"keyreqs\":%u,"
+             "\"rejected\":%u,\"dict_miss\":%u,\"seq\":%u,\"active\":%s,\"synced\":%s},"
+             "\"fec\":{\"recovered\":%u,\"duplicates\":%u,\"unrecoverable\":%u},"
+             "\"sub\":{\"subscribed\":%s,\"link\":\"%s\",\"source\":\"%s\",\"joins\":%u,\"loss_pct\":%d},"
+             "\"mcast\":{\"group\":\"%s\",\"joined\":%s},"
+             "\"espnow\":{\"enabled\":%s,\"ready\":%s,\"dropped\":%u},"
+             "\"loop\":{\"self\":%u,\"mirror\":%u},"
+             "\"json_skipped\":%u,\"i2c_cells\":%u}",
+             g_deviceId, (unsigned)g_udpPacketCount, (unsigned)g_binFrames, (unsigned)g_binDeltas, (unsigned)g_binGaps,
+             (unsigned)g_keyReqs, (unsigned)g_binRejected, (unsigned)g_dictMisses, (unsigned)g_binSeq,
+             (g_binSeen && (millis() - g_lastBinMs) < BIN_ACTIVE_MS) ? "true" : "false",
+             g_binHaveBase ? "true" : "false",
+             (unsigned)g_fecRecovered, (unsigned)g_fecDuplicates, (unsigned)g_fecUnrecoverable,
+             g_subscribed ? "true" : "false", g_subLink->name(), source, (unsigned)g_joins,
+             g_lossPct == LCDFrame::kLossUnknown ? -1 : (int)g_lossPct,
+             g_mcastGroup.toString().c_str(), g_udp.joined() ? "true" : "false",
+             g_espnowEnabled ? "true" : "false", g_espnow.ready() ? "true" : "false", (unsigned)g_espnow.dropped(),
+             (unsigned)g_dropSelf, (unsigned)g_dropMirror,
+             (unsigned)g_jsonSkipped, (unsigned)g_i2cCellsWritten);
+    request->send(200, "application/json", j);
+  });
+
+  // /rx/mcast?group=239.255.76.67 | group=off. Persisted; the socket re-joins in loop().
+  WiFiMgr::getServer().on("/rx/mcast", HTTP_ANY, [](AsyncWebServerRequest* request){
+    if (request->hasParam("group")) {
+      const String v = request->getParam("group")->value();
+      IPAddress group;
+      if (v == "off") {
+        group = IPAddress((uint32_t)0);
+      } else if (!group.fromString(v) || group[0] < 224 || group[0] > 239) {
+        request->send(400, "text/plain", "group must be an IPv4 multicast address or off");
+        return;
+      }
+      Preferences prefs;
+      prefs.begin("rx", false);
+      prefs.putString("mcast", (uint32_t)group ? group.toString() : String("off"));
+      prefs.end();
+      g_mcastNew = (uint32_t)group;
+      g_mcastChanged = true;
+    }
+    char j[96];
+    const IPAddress shown = g_mcastChanged ? IPAddress((uint32_t)g_mcastNew) : g_mcastGroup;
+    snprintf(j, sizeof(j), "{\"group\":\"%s\",\"joined\":%s}",
+             (uint32_t)shown ? shown.toString().c_str() : "off", g_udp.joined() ? "true" : "false");
+    request->send(200, "application/json", j);
+  });
+
+  // /rx/espnow?on=1|0. Persisted; loop() starts or stops the link.
+  WiFiMgr::getServer().on("/rx/espnow", HTTP_ANY, [](AsyncWebServerRequest* request){
+    if (request->hasParam("on")) {
+      g_espnowEnabled = request->getParam("on")->value().toInt() != 0;
+      Preferences prefs;
+      prefs.begin("rx", false);
+      prefs.putBool("espnow", g_espnowEnabled);
+      prefs.end();
+    }
+    char j[96];
+    snprintf(j, sizeof(j), "{\"enabled\":%s,\"ready\":%s}",
+             g_espnowEnabled ? "true" : "false", g_espnow.ready() ? "true" : "false");
+    request->send(200, "application/json", j);
+  });
+}
+
 void setup() {
   Serial.begin(115200);
   delay(50);
 
   LedStat::begin();
   WiFiMgr::begin();
+  register_stats_endpoint();
 
   lcd.begin(PIN_SDA, PIN_SCL, PIN_RST, US2066_I2C_ADDR);
+  snprintf(g_deviceId, sizeof(g_deviceId), "%012llx", (unsigned long long)ESP.getEfuseMac());
+  lcd.setTelemetrySource(g_deviceId);
 
+  load_mcast_group();
+  load_espnow();
   ensureUdp();
 
   currentPage = Page::Splash;
@@ -196,26 +612,100 @@ void setup() {
 static uint32_t lastPaintMs = 0;
 static uint32_t lastSplashRefreshMs = 0;
 
+static void handle_packet(FrameTransport::Link* link, const FrameTransport::Endpoint& from,
+                          const uint8_t* payload, size_t len) {
+  g_rxLink = link;
+  g_rxFrom = from;
+  const uint32_t now = millis();
+
+  // Our own broadcasts (telemetry) come back on the shared port
+  if (link == &g_udp && from.sameHost(FrameTransport::UdpLink::endpoint(WiFi.localIP(), 0))) {
+    g_dropSelf++;
+    return;
+  }
+
+  if (link == &g_espnow) {
+    // Other receivers' join broadcasts share the air; only frames matter here
+    LCDFrame::Packet pkt;
+    if (LCDFrame::parse(payload, len, pkt) != LCDFrame::Result::Ok ||
+        (pkt.type != LCDFrame::TYPE_FULL && pkt.type != LCDFrame::TYPE_DELTA)) {
+      return;
+    }
+    if (!(g_subscribed && g_subLink == &g_espnow)) {
+      adopt_espnow(from);
+    } else if (!from.sameHost(g_subSource)) {
+      // A second Transmitter took our join broadcast; one stream is enough
+      uint8_t buf[16];
+      send_control(link, from, buf, LCDFrame::encodeLeave(buf, sizeof(buf)));
+      return;
+    }
+  }
+
+  const bool binActive = g_binSeen && g_binHaveBase && (now - g_lastBinMs) < BIN_ACTIVE_MS;
+  LCD20x4State tmp;
+  bool accepted = false;
+  if (LCDFrame::isBinary(payload, len)) {
+    accepted = parse_binary(payload, len, tmp);
+  } else if (binActive && (g_binLink == &g_espnow || (g_binLink == link && from.sameHost(g_binSource)))) {
+    g_jsonSkipped++;               // same frame already arrived in binary
+  } else {
+    JsonMeta meta;
+    accepted = parse_lcd20x4(payload, len, tmp, &meta);
+    if (accepted && meta.src[0] && strcmp(meta.src, g_deviceId) == 0) {
+      g_dropSelf++;
+      return;
+    }
+    if (accepted && meta.hop > 0) {
+      g_dropMirror++;                // another panel's telemetry: showing it would echo it again
+      return;
+    }
+    if (accepted && meta.repeat) {
+      if (g_jsonGenValid && meta.gen == g_jsonGen) {
+        g_fecDuplicates++;
+        accepted = false;
+      } else {
+        g_fecRecovered++;
+      }
+    }
+    if (accepted) {
+      g_jsonGen = meta.gen;
+      g_jsonGenValid = true;
+    }
+    // With ESP-NOW up, give a Transmitter there the first chance to answer our join
+    const bool espnowPending = g_espnow.ready() && now - g_espnowUpMs < ESPNOW_GRACE_MS;
+    if (meta.offers_bin && !g_subscribed && !espnowPending) {
+      send_join();
+    }
+  }
+  if (g_subscribed && g_subLink == link && from.sameHost(g_subSource)) g_lastSubRxMs = millis();
+
+  if (accepted) {
+    g_state     = tmp;
+    g_haveData  = true;
+    g_udpPacketCount++;
+    currentPage = Page::Live;
+    LedStat::setStatus(LedStatus::UdpTransmit);
+  }
+}
+
 void loop() {
   WiFiMgr::loop();
   LedStat::loop();
 
   ensureMdns();
   ensureUdp();
+  ensureEspNow(millis());
 
-  int pkt = g_udp.parsePacket();
-  if (pkt > 0) {
-    String payload; payload.reserve(min(pkt, 1024));
-    while (g_udp.available()) payload += (char)g_udp.read();
+  service_subscription(millis());
 
-    LCD20x4State tmp;
-    if (parse_lcd20x4(payload, tmp)) {
-      g_state     = tmp;
-      g_haveData  = true;
-      g_udpPacketCount++;           
-      currentPage = Page::Live;     
-      LedStat::setStatus(LedStatus::UdpTransmit);
-    }
+  static uint8_t payload[1024];
+  FrameTransport::Endpoint from;
+  size_t len;
+  if ((len = g_espnow.receive(payload, sizeof(payload), from)) > 0) {
+    handle_packet(&g_espnow, from, payload, len);
+  }
+  if ((len = g_udp.receive(payload, sizeof(payload), from)) > 0) {
+    handle_packet(&g_udp, from, payload, len);
   }
 
   uint32_t now = millis();
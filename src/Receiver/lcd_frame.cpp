@@ -0,0 +1,403 @@
+// lcd_frame.cpp
+//
+// Binary LCD stream codec. Keep identical in src/Transmitter and src/Receiver.
+
+#include "lcd_frame.h"
+#include <string.h>
+
+namespace LCDFrame {
+
+namespace {
+
+    inline char printable(uint8_t c) {
+        return (c >= 0x20 && c <= 0x7E) ? (char)c : ' ';
+    }
+
+    uint8_t packFlags(const Frame& f) {
+        return (uint8_t)((f.display_on ? FLAG_DISP : 0) |
+                         (f.cursor_on  ? FLAG_CUR  : 0) |
+                         (f.blink_on   ? FLAG_BLINK : 0));
+    }
+
+    void writeHeader(uint8_t* out, uint8_t type, uint16_t seq, uint8_t flags, uint8_t cursor) {
+        out[0] = kMagic0;
+        out[1] = kMagic1;
+        out[2] = kVersion;
+        out[3] = type;
+        out[4] = (uint8_t)(seq & 0xFF);
+        out[5] = (uint8_t)(seq >> 8);
+        out[6] = flags;
+        out[7] = cursor;
+    }
+
+    uint8_t packCursor(const Frame& f) {
+        return (uint8_t)(((f.cursor_row & 0x03) << 5) | (f.cursor_col & 0x1F));
+    }
+
+    void applyHeader(const Packet& p, Frame& f) {
+        f.cursor_row = p.cursor_row;
+        f.cursor_col = p.cursor_col < kCols ? p.cursor_col : (uint8_t)(kCols - 1);
+        f.display_on = (p.flags & FLAG_DISP) != 0;
+        f.cursor_on  = (p.flags & FLAG_CUR) != 0;
+        f.blink_on   = (p.flags & FLAG_BLINK) != 0;
+    }
+
+    // Changed cells separated by fewer unchanged cells than a span header costs are merged
+    static constexpr uint8_t kSpanHeader = 2;
+
+    // Spans [row << 5 | col][len][bytes] turning 'base' into 'cur' for row r. Returns the
+    // byte count; writes only when out != nullptr.
+    size_t rowSpans(uint8_t* out, uint8_t r, const char* base, const char* cur) {
+        size_t len = 0;
+        uint8_t c = 0;
+        while (c < kCols) {
+            if (cur[c] == base[c]) { ++c; continue; }
+
+            // Extend the span while the next change is closer than a new span header
+            const uint8_t start = c;
+            uint8_t end = (uint8_t)(c + 1);
+            for (uint8_t k = end; k < kCols; ++k) {
+                if (cur[k] != base[k]) {
+                    if (k - end <= kSpanHeader) end = (uint8_t)(k + 1);
+                    else break;
+                }
+            }
+
+            const uint8_t n = (uint8_t)(end - start);
+            if (out) {
+                out[len]     = (uint8_t)((r << 5) | start);
+                out[len + 1] = n;
+                memcpy(out + len + kSpanHeader, cur + start, n);
+            }
+            len += kSpanHeader + n;
+            c = end;
+        }
+        return len;
+    }
+
+    // base shifted by k cells (k > 0: content moves left), edge cells taken from 'cur'
+    void shiftRow(char* dst, const char* base, const char* cur, int8_t k) {
+        for (int c = 0; c < kCols; ++c) {
+            const int src = c + k;
+            dst[c] = (src >= 0 && src < kCols) ? base[src] : cur[c];
+        }
+    }
+
+    static constexpr uint8_t kDictOpSize = 5;
+
+    // Entry for the dict op at 'op' (id and check), or nullptr
+    const RowDict::Entry* dictFind(const RowDict& d, const uint8_t* op) {
+        const uint16_t id = (uint16_t)(op[1] | (op[2] << 8));
+        const uint16_t check = (uint16_t)(op[3] | (op[4] << 8));
+        for (const RowDict::Entry& e : d.entries) {
+            if (e.valid && e.id == id) return e.check == check ? &e : nullptr;
+        }
+        return nullptr;
+    }
+
+    // Encode row r of a delta as the cheapest of plain spans, a shift op plus spans, or a
+    // dictionary reference plus spans. Scrolling marquees become one shift op and the |k|
+    // new edge characters; a screen seen before costs kDictOpSize bytes per row.
+    size_t encodeRow(uint8_t* out, uint8_t r, const char* base, const char* cur,
+                     DeltaInfo* info, const RowDict* dict) {
+        size_t best = rowSpans(nullptr, r, base, cur);
+        int8_t best_k = 0;
+        const RowDict::Entry* best_e = nullptr;
+        if (best > kSpanHeader + 1) {
+            char shifted[kCols];
+            for (int k = -(kCols - 1); k <= kCols - 1; ++k) {
+                if (k == 0) continue;
+                const size_t edge = (size_t)(k > 0 ? k : -k);
+                if (kSpanHeader + edge >= best) continue;
+                shiftRow(shifted, base, cur, (int8_t)k);
+                const size_t cost = kSpanHeader + edge + rowSpans(nullptr, r, shifted, cur);
+                if (cost < best) {
+                    best = cost;
+                    best_k = (int8_t)k;
+                }
+            }
+        }
+        if (dict && best > kDictOpSize) {
+            for (const RowDict::Entry& e : dict->entries) {
+                if (!e.valid) continue;
+                const size_t cost = kDictOpSize + rowSpans(nullptr, r, e.row, cur);
+                if (cost < best) {
+                    best = cost;
+                    best_e = &e;
+                }
+            }
+        }
+
+        if (best_e) {
+            out[0] = (uint8_t)((r << 5) | kSpanDict);
+            out[1] = (uint8_t)(best_e->id & 0xFF);
+            out[2] = (uint8_t)(best_e->id >> 8);
+            out[3] = (uint8_t)(best_e->check & 0xFF);
+            out[4] = (uint8_t)(best_e->check >> 8);
+            if (info) info->dict_rows++;
+            return kDictOpSize + rowSpans(out + kDictOpSize, r, best_e->row, cur);
+        }
+        if (best_k == 0) {
+            if (info && best) info->span_rows++;
+            return rowSpans(out, r, base, cur);
+        }
+
+        const uint8_t edge = (uint8_t)(best_k > 0 ? best_k : -best_k);
+        out[0] = (uint8_t)((r << 5) | kSpanShift);
+        out[1] = (uint8_t)best_k;
+        const uint8_t first = best_k > 0 ? (uint8_t)(kCols - edge) : 0;
+        memcpy(out + kSpanHeader, cur + first, edge);
+
+        char shifted[kCols];
+        shiftRow(shifted, base, cur, best_k);
+        if (info) info->shift_rows++;
+        return kSpanHeader + edge + rowSpans(out + kSpanHeader + edge, r, shifted, cur);
+    }
+
+    size_t finish(uint8_t* out, size_t len) {
+        const uint16_t crc = crc16(out, len);
+        out[len]     = (uint8_t)(crc & 0xFF);
+        out[len + 1] = (uint8_t)(crc >> 8);
+        return len + kCrcSize;
+    }
+
+    // Control packet whose payload is one Format bitmask
+    size_t encodeFormats(uint8_t* out, size_t cap, uint8_t type, uint8_t formats) {
+        const size_t len = kHeaderSize + 1;
+        if (cap < len + kCrcSize) return 0;
+        writeHeader(out, type, 0, 0, 0);
+        out[kHeaderSize] = formats;
+        return finish(out, len);
+    }
+
+} // namespace
+
+uint16_t crc16(const uint8_t* data, size_t len) {
+    uint16_t crc = 0xFFFF;
+    for (size_t i = 0; i < len; ++i) {
+        crc ^= (uint16_t)data[i] << 8;
+        for (int b = 0; b < 8; ++b) {
+            crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+uint16_t rowId(const char* row) {
+    uint32_t h = 2166136261u;
+    for (uint8_t c = 0; c < kCols; ++c) {
+        h ^= (uint8_t)row[c];
+        h *= 16777619u;
+    }
+    return (uint16_t)((h >> 16) ^ (h & 0xFFFF));
+}
+
+uint16_t rowCheck(const char* row) {
+    return crc16((const uint8_t*)row, kCols);
+}
+
+void dictClear(RowDict& d) {
+    memset(d.entries, 0, sizeof(d.entries));
+    d.tick = 0;
+}
+
+void dictLearn(RowDict& d, const Frame& f) {
+    for (uint8_t r = 0; r < kRows; ++r) {
+        char row[kCols];
+        for (uint8_t c = 0; c < kCols; ++c) row[c] = printable((uint8_t)f.rows[r][c]);
+        const uint16_t id = rowId(row);
+
+        // Same id (same row, or a collision that evicts the older row), else a free slot,
+        // else the least recently seen row
+        RowDict::Entry* slot = nullptr;
+        for (RowDict::Entry& e : d.entries) {
+            if (e.valid && e.id == id) { slot = &e; break; }
+            if (!slot || (slot->valid && (!e.valid || e.used < slot->used))) slot = &e;
+        }
+        memcpy(slot->row, row, kCols);
+        slot->id = id;
+        slot->check = rowCheck(row);
+        slot->used = ++d.tick;
+        slot->valid = true;
+    }
+}
+
+bool isBinary(const uint8_t* data, size_t len) {
+    return len >= 2 && data[0] == kMagic0 && data[1] == kMagic1;
+}
+
+size_t encodeFull(uint8_t* out, size_t cap, uint16_t seq, const Frame& f) {
+    const size_t len = kHeaderSize + kRows * kCols;
+    if (cap < len + kCrcSize) return 0;
+
+    writeHeader(out, TYPE_FULL, seq, packFlags(f), packCursor(f));
+
+    uint8_t* p = out + kHeaderSize;
+    for (uint8_t r = 0; r < kRows; ++r) {
+        for (uint8_t c = 0; c < kCols; ++c) *p++ = (uint8_t)printable((uint8_t)f.rows[r][c]);
+    }
+    return finish(out, len);
+}
+
+size_t encodeDelta(uint8_t* out, size_t cap, uint16_t seq, uint16_t base_seq,
+                   const Frame& base, const Frame& f, DeltaInfo* info, const RowDict* dict) {
+    if (cap < kHeaderSize + 2 + kCrcSize) return 0;
+    const size_t full = kHeaderSize + kRows * kCols;
+    const size_t limit = (cap - kCrcSize) < full ? (cap - kCrcSize) : full;
+
+    writeHeader(out, TYPE_DELTA, seq, packFlags(f), packCursor(f));
+    out[kHeaderSize]     = (uint8_t)(base_seq & 0xFF);
+    out[kHeaderSize + 1] = (uint8_t)(base_seq >> 8);
+    size_t len = kHeaderSize + 2;
+
+    for (uint8_t r = 0; r < kRows; ++r) {
+        char prev[kCols], cur[kCols];
+        for (uint8_t c = 0; c < kCols; ++c) {
+            prev[c] = printable((uint8_t)base.rows[r][c]);
+            cur[c]  = printable((uint8_t)f.rows[r][c]);
+        }
+
+        // Worst case for one row is every cell as a single span
+        uint8_t row_buf[kSpanHeader * 2 + kCols * 2];
+        const size_t n = encodeRow(row_buf, r, prev, cur, info, dict);
+        if (len + n >= limit) return 0;
+        memcpy(out + len, row_buf, n);
+        len += n;
+    }
+    return finish(out, len);
+}
+
+size_t encodeKeyRequest(uint8_t* out, size_t cap, uint16_t last_seq) {
+    if (cap < kHeaderSize + kCrcSize) return 0;
+    writeHeader(out, TYPE_KEYREQ, last_seq, 0, 0);
+    return finish(out, kHeaderSize);
+}
+
+size_t markRepeat(uint8_t* pkt, size_t len) {
+    if (len < kHeaderSize + kCrcSize || !isBinary(pkt, len)) return 0;
+    pkt[6] |= FLAG_REPEAT;
+    return finish(pkt, len - kCrcSize);
+}
+
+size_t encodeCaps(uint8_t* out, size_t cap, uint8_t formats) {
+    return encodeFormats(out, cap, TYPE_CAPS, formats);
+}
+
+size_t encodeJoin(uint8_t* out, size_t cap, uint8_t formats) {
+    return encodeFormats(out, cap, TYPE_JOIN, formats);
+}
+
+size_t encodeAlive(uint8_t* out, size_t cap, uint8_t formats, uint8_t loss_pct) {
+    if (loss_pct == kLossUnknown) return encodeFormats(out, cap, TYPE_ALIVE, formats);
+    const size_t len = kHeaderSize + 2;
+    if (cap < len + kCrcSize) return 0;
+    writeHeader(out, TYPE_ALIVE, 0, 0, 0);
+    out[kHeaderSize] = formats;
+    out[kHeaderSize + 1] = loss_pct;
+    return finish(out, len);
+}
+
+size_t encodeLeave(uint8_t* out, size_t cap) {
+    if (cap < kHeaderSize + kCrcSize) return 0;
+    writeHeader(out, TYPE_LEAVE, 0, 0, 0);
+    return finish(out, kHeaderSize);
+}
+
+Result parse(const uint8_t* data, size_t len, Packet& out) {
+    if (!isBinary(data, len)) return Result::NotBinary;
+    if (len < kHeaderSize + kCrcSize) return Result::Truncated;
+    if (data[2] != kVersion) return Result::BadVersion;
+
+    const size_t body = len - kCrcSize;
+    const uint16_t crc = (uint16_t)(data[body] | (data[body + 1] << 8));
+    if (crc16(data, body) != crc) return Result::BadCrc;
+
+    out.type = data[3];
+    out.seq = (uint16_t)(data[4] | (data[5] << 8));
+    out.flags = data[6];
+    out.cursor_row = (uint8_t)((data[7] >> 5) & 0x03);
+    out.cursor_col = (uint8_t)(data[7] & 0x1F);
+    out.payload = data + kHeaderSize;
+    out.payload_len = body - kHeaderSize;
+    return Result::Ok;
+}
+
+Result decodeFull(const Packet& p, Frame& f) {
+    if (p.type != TYPE_FULL || p.payload_len != (size_t)kRows * kCols) return Result::BadPayload;
+
+    const uint8_t* src = p.payload;
+    for (uint8_t r = 0; r < kRows; ++r) {
+        for (uint8_t c = 0; c < kCols; ++c) f.rows[r][c] = printable(*src++);
+        f.rows[r][kCols] = '\0';
+    }
+    applyHeader(p, f);
+    return Result::Ok;
+}
+
+uint16_t deltaBase(const Packet& p) {
+    return p.payload_len >= 2 ? (uint16_t)(p.payload[0] | (p.payload[1] << 8)) : 0;
+}
+
+Result applyDelta(const Packet& p, Frame& f, const RowDict* dict) {
+    if (p.type != TYPE_DELTA || p.payload_len < 2) return Result::BadPayload;
+
+    // Validate every op before touching the frame
+    size_t i = 2;
+    while (i < p.payload_len) {
+        if (i + kSpanHeader > p.payload_len) return Result::BadPayload;
+        const uint8_t row = p.payload[i] >> 5;
+        const uint8_t col = p.payload[i] & 0x1F;
+        if (row >= kRows) return Result::BadPayload;
+        if (col == kSpanShift) {
+            const int8_t k = (int8_t)p.payload[i + 1];
+            const uint8_t edge = (uint8_t)(k > 0 ? k : -k);
+            if (k == 0 || edge >= kCols || i + kSpanHeader + edge > p.payload_len) return Result::BadPayload;
+            i += kSpanHeader + edge;
+            continue;
+        }
+        if (col == kSpanDict) {
+            if (i + kDictOpSize > p.payload_len) return Result::BadPayload;
+            if (!dict || !dictFind(*dict, p.payload + i)) return Result::UnknownRow;
+            i += kDictOpSize;
+            continue;
+        }
+        const uint8_t n = p.payload[i + 1];
+        if (n == 0 || col + n > kCols || i + kSpanHeader + n > p.payload_len) {
+            return Result::BadPayload;
+        }
+        i += kSpanHeader + n;
+    }
+
+    // Ops apply in order; spans after a shift patch the shifted row
+    i = 2;
+    while (i < p.payload_len) {
+        const uint8_t row = p.payload[i] >> 5;
+        const uint8_t col = p.payload[i] & 0x1F;
+        if (col == kSpanShift) {
+            const int8_t k = (int8_t)p.payload[i + 1];
+            const uint8_t edge = (uint8_t)(k > 0 ? k : -k);
+            const uint8_t first = k > 0 ? (uint8_t)(kCols - edge) : 0;
+            char shifted[kCols];
+            for (int c = 0; c < kCols; ++c) {
+                const int src = c + k;
+                shifted[c] = (src >= 0 && src < kCols) ? f.rows[row][src]
+                                                       : printable(p.payload[i + kSpanHeader + (c - first)]);
+            }
+            memcpy(f.rows[row], shifted, kCols);
+            i += kSpanHeader + edge;
+            continue;
+        }
+        if (col == kSpanDict) {
+            memcpy(f.rows[row], dictFind(*dict, p.payload + i)->row, kCols);
+            i += kDictOpSize;
+            continue;
+        }
+        const uint8_t n = p.payload[i + 1];
+        for (uint8_t k = 0; k < n; ++k) f.rows[row][col + k] = printable(p.payload[i + kSpanHeader + k]);
+        i += kSpanHeader + n;
+    }
+    applyHeader(p, f);
+    return Result::Ok;
+}
+
+} // namespace LCDFrame
@@ -0,0 +1,197 @@
+// lcd_frame.h
+//
+// Compact binary wire format for the 20x4 LCD stream on UDP 35182.
+// Shared by the Transmitter (encoder) and the Receiver (decoder); keep the copies in
+// src/Transmitter and src/Receiver identical. No Arduino dependencies, so the codec also
+// builds on a Linux host.
+//
+// Packet layout (little endian):
+//   0  magic0 (0xA7)      never valid as the first byte of UTF-8 text, so JSON parsers
+//   1  magic1 (0x4C 'L')  reject it instantly and binary parsers reject JSON
+//   2  version
+//   3  type               Type
+//   4  seq (u16)          sender frame counter
+//   6  flags              FLAG_* display flags
+//   7  cursor             row << 5 | col
+//   8  payload            type-specific
+//   n-2 crc16             CRC-16/CCITT-FALSE over bytes [0, n-2)
+//
+// Stream mode: a TYPE_FULL keyframe is followed by TYPE_DELTA frames, each naming the seq
+// of the frame it applies to. A receiver that misses one stops applying deltas and asks
+// for a keyframe (TYPE_KEYREQ) or waits for the next periodic one.
+//
+// Both ends keep a RowDict of recently seen rows so a delta can name a known row by its
+// 16-bit id and check instead of spelling it out (screens the dashboard cycles back to). Sender and
+// receiver learn every frame they send/apply with the same rule; keyframes that resync a
+// receiver (new peer, KEYREQ, sender restart) clear the dictionary on both sides.
+//
+// Control channel (receiver -> sender, same port): TYPE_JOIN subscribes with the formats
+// the receiver wants, TYPE_ALIVE refreshes the subscription (and re-creates it if the sender
+// restarted), TYPE_LEAVE ends it. Subscribers are sent frames unicast; the sender broadcasts
+// JSON only while nobody is subscribed, plus a periodic beacon so new receivers find it.
+// Senders advertise the formats they can emit in the JSON frame ("fmt"). TYPE_CAPS is the
+// older join and is still accepted.
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+namespace LCDFrame {
+
+    static constexpr uint8_t kMagic0     = 0xA7;
+    static constexpr uint8_t kMagic1     = 0x4C;
+    static constexpr uint8_t kVersion    = 1;
+    static constexpr uint8_t kRows       = 4;
+    static constexpr uint8_t kCols       = 20;
+    static constexpr size_t  kHeaderSize = 8;
+    static constexpr size_t  kCrcSize    = 2;
+    static constexpr size_t  kMaxPacket  = 256;
+
+    enum Type : uint8_t {
+        TYPE_FULL   = 0x01,   // keyframe. payload: kRows * kCols row bytes
+        TYPE_DELTA  = 0x02,   // payload: base seq (u16), then ops (see below)
+        TYPE_CAPS   = 0x10,   // payload: one Format bitmask (receiver -> sender), = TYPE_JOIN
+        TYPE_KEYREQ = 0x11,   // receiver -> sender: send a keyframe. header seq = last applied
+        TYPE_JOIN   = 0x12,   // payload: Format bitmask wanted. Sender replies with the current frame
+        TYPE_LEAVE  = 0x13,   // no payload
+        TYPE_ALIVE  = 0x14,   // payload: Format bitmask (as TYPE_JOIN, without the immediate frame),
+                              // optionally followed by the receiver's loss percentage (feedback)
+    };
+
+    // TYPE_ALIVE loss byte: percent of binary frames lost since the previous keep-alive
+    static constexpr uint8_t kLossUnknown = 0xFF;
+
+    // Delta ops, applied in order:
+    //   span   [row << 5 | col][len][len bytes]         col 0..19
+    //   shift  [row << 5 | kSpanShift][int8 k][|k| bytes]
+    //   dict   [row << 5 | kSpanDict][id (u16)][check (u16)]
+    // A shift moves the row's content k cells (k > 0: left, as a marquee does) and fills
+    // the |k| uncovered cells from the payload, left to right. A dict op replaces the row
+    // with the RowDict entry 'id' if that entry's rowCheck() equals 'check'; spans after it
+    // patch the differences.
+    static constexpr uint8_t kSpanShift = 0x1F;
+    static constexpr uint8_t kSpanDict  = 0x1E;
+
+    // Rows remembered per RowDict (least recently seen is replaced)
+    static constexpr uint8_t kDictSize  = 32;
+
+    enum Flags : uint8_t {
+        FLAG_DISP  = 0x01,
+        FLAG_CUR   = 0x02,
+        FLAG_BLINK = 0x04,
+        FLAG_MIRROR = 0x40,   // not a display flag: re-sent by a device that received it (hop > 0)
+        FLAG_REPEAT = 0x80,   // not a display flag: FEC copy of a packet already sent (same seq)
+    };
+
+    // Stream formats a node can emit or decode (TYPE_CAPS payload)
+    enum Format : uint8_t {
+        FMT_JSON = 0x01,
+        FMT_BIN1 = 0x02,
+    };
+
+    enum class Result : uint8_t {
+        Ok = 0,
+        NotBinary,     // no magic (JSON or foreign traffic)
+        Truncated,
+        BadVersion,
+        BadCrc,
+        BadPayload,    // length does not match the type
+        UnknownRow,    // delta names a row missing from our RowDict (ask for a keyframe)
+    };
+
+    // Decoded/encodable screen contents (same shape as LCDMonitor::DisplayFrame rows)
+    struct Frame {
+        char rows[kRows][kCols + 1];
+        uint8_t cursor_row = 0;
+        uint8_t cursor_col = 0;
+        bool display_on = true;
+        bool cursor_on = false;
+        bool blink_on = false;
+    };
+
+    // What encodeDelta() chose, per row with changes
+    struct DeltaInfo {
+        uint8_t span_rows = 0;
+        uint8_t shift_rows = 0;
+        uint8_t dict_rows = 0;
+    };
+
+    // Recently seen rows keyed by rowId(). Both ends must feed it the same frames in the
+    // same order (dictLearn) for ids to resolve to the same contents.
+    struct RowDict {
+        struct Entry {
+            char row[kCols];
+            uint16_t id;
+            uint16_t check;    // rowCheck(row)
+            uint32_t used;     // tick of the last dictLearn() that saw this row
+            bool valid;
+        };
+        Entry entries[kDictSize] = {};
+        uint32_t tick = 0;
+    };
+
+    // Parsed header; payload points into the caller's buffer
+    struct Packet {
+        uint8_t type = 0;
+        uint16_t seq = 0;
+        uint8_t flags = 0;
+        uint8_t cursor_row = 0;
+        uint8_t cursor_col = 0;
+        const uint8_t* payload = nullptr;
+        size_t payload_len = 0;
+    };
+
+    uint16_t crc16(const uint8_t* data, size_t len);
+
+    // 16-bit id of a kCols-byte row (FNV-1a folded)
+    uint16_t rowId(const char* row);
+
+    // Independent 16-bit check of the same row (CRC-16), sent beside the id so a receiver
+    // whose dictionary holds a different row under that id finds out
+    uint16_t rowCheck(const char* row);
+
+    void dictClear(RowDict& d);
+
+    // Record every row of 'f' (after a frame is sent or applied). A row whose id matches a
+    // different stored row replaces it, so ids stay unique within a dictionary.
+    void dictLearn(RowDict& d, const Frame& f);
+
+    // Cheap check before committing to a parse (magic only)
+    bool isBinary(const uint8_t* data, size_t len);
+
+    // Encoders return the packet size, or 0 if 'cap' is too small.
+    size_t encodeFull(uint8_t* out, size_t cap, uint16_t seq, const Frame& f);
+    size_t encodeCaps(uint8_t* out, size_t cap, uint8_t formats);
+
+    // Subscription control. formats: Format bits the receiver decodes (binary preferred).
+    size_t encodeJoin(uint8_t* out, size_t cap, uint8_t formats);
+    size_t encodeAlive(uint8_t* out, size_t cap, uint8_t formats, uint8_t loss_pct = kLossUnknown);
+    size_t encodeLeave(uint8_t* out, size_t cap);
+
+    // Delta against 'base' (seq base_seq). Returns 0 if it would not be smaller than a
+    // keyframe or does not fit; the caller then sends encodeFull() instead. With 'dict',
+    // rows are also tried as a reference to a known row.
+    size_t encodeDelta(uint8_t* out, size_t cap, uint16_t seq, uint16_t base_seq,
+                       const Frame& base, const Frame& f, DeltaInfo* info = nullptr,
+                       const RowDict* dict = nullptr);
+    size_t encodeKeyRequest(uint8_t* out, size_t cap, uint16_t last_seq);
+
+    // Turn an encoded packet into its FEC repeat in place (sets FLAG_REPEAT, redoes the CRC).
+    // Returns len, or 0 if it is not a packet.
+    size_t markRepeat(uint8_t* pkt, size_t len);
+
+    // Validate magic, version and CRC and split out the header.
+    Result parse(const uint8_t* data, size_t len, Packet& out);
+
+    // Apply a TYPE_FULL packet to 'f'. Non-printable bytes become spaces.
+    Result decodeFull(const Packet& p, Frame& f);
+
+    // Base seq a TYPE_DELTA packet applies to
+    uint16_t deltaBase(const Packet& p);
+
+    // Apply a TYPE_DELTA packet on top of 'f' (which must be the frame deltaBase() names).
+    // 'f' is untouched unless the whole payload is well formed and every dict op resolves
+    // in 'dict' to a row with the matching check (UnknownRow otherwise).
+    Result applyDelta(const Packet& p, Frame& f, const RowDict* dict = nullptr);
+}
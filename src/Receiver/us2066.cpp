@@ -123,7 +123,7 @@ bool US2066LCD::begin(int sda, int scl, int rst, uint8_t addr) {
   }
   _disp_on = true; _cur_on = false; _blink = false;
   _cursor_row = 0; _cursor_col = 0;
-  _lastUpdateMs = millis();
+  _touch();
 
   _inited = !_i2cError;
   return _inited;
@@ -283,6 +283,31 @@ void US2066LCD::writeRow(uint8_t row, const String& text) {
   _touch();
 }
 
+void US2066LCD::writeSpan(uint8_t row, uint8_t col, const char* text, uint8_t len) {
+  if (row >= _rows || col >= _cols) return;
+  if (col + len > _cols) len = _cols - col;
+  if (len == 0) return;
+
+  int16_t c0 = (int16_t)col + (int16_t)_global_col_offset;
+  if (c0 < 0) c0 = 0;
+  if (c0 >= _cols) c0 = _cols - 1;
+
+  uint8_t addr = (uint8_t)(_row_addresses[row] + (uint8_t)c0);
+  i2cSend2(_addr, CTRL_CMD, (uint8_t)(CMD_SET_DDRAM | addr), _i2cError);
+
+  uint8_t buf[40];
+  for (uint8_t i = 0; i < len; ++i) {
+    char ch = text[i];
+    if (ch < 0x20 || ch > 0x7E) ch = ' ';
+    buf[i] = (uint8_t)ch;
+    if (col + i < 20) _rows_buf[row][col + i] = (char)buf[i];
+  }
+  i2cSendBlock(_addr, CTRL_DATA, buf, len, _i2cError);
+
+  _cursor_row = row;
+  _cursor_col = (uint8_t)(col + len - 1);
+  _touch();
+}
 
 void US2066LCD::enterOledCmdSet() {
   i2cSend2(_addr, CTRL_CMD, CMD_FUNCSET_RE1, _i2cError); // RE=1
@@ -340,6 +365,12 @@ void US2066LCD::enableTelemetry(bool on) {
   }
 }
 
+void US2066LCD::setTelemetrySource(const char* id) {
+  strncpy(_src, id ? id : "", sizeof(_src) - 1);
+  _src[sizeof(_src) - 1] = '\0';
+  _touch();
+}
+
 void US2066LCD::setTelemetryIntervalMs(uint32_t ms) {
   if (ms < 100) ms = 100;
   _txIntervalMs = ms;
@@ -357,42 +388,38 @@ void US2066LCD::loop() {
 
 void US2066LCD::_touch() {
   _lastUpdateMs = millis();
+  _gen++;
 }
 
 void US2066LCD::_broadcast(bool /*force*/) {
   if (!_telemetryEnabled) return;
 
-  String j;
-  j.reserve(256);
-  j += F("{\"type\":\"lcd20x4\",\"mode\":\"US2066\",\"addr\":\"0x");
-  if (_addr < 16) j += '0';
-  j += String(_addr, HEX);
-  j += F("\",\"disp\":");
-  j += (_disp_on ? F("true") : F("false"));
-  j += F(",\"cur\":");
-  j += (_cur_on ? F("true") : F("false"));
-  j += F(",\"blink\":");
-  j += (_blink ? F("true") : F("false"));
-  j += F(",\"cursor\":{\"r\":");
-  j += String(_cursor_row);
-  j += F(",\"c\":");
-  j += String(_cursor_col);
-  j += F("},\"rows\":[");
-  for (int r = 0; r < 4; ++r) {
-    if (r) j += ',';
-    j += '\"';
-    for (int c = 0; c < 20; ++c) {
-      char ch = _rows_buf[r][c];
-      if (ch < 0x20 || ch > 0x7E) ch = ' ';
-      if (ch == '\"' || ch == '\\') { j += '\\'; }
-      j += ch;
-    }
-    j += '\"';
+  // Re-sent every loop while the panel is changing: serialize once per state change
+  if (!_jsonLen || _jsonGen != _gen) {
+    LCDFrame::Frame f;
+    memcpy(f.rows, _rows_buf, sizeof(f.rows));
+    f.cursor_row = _cursor_row;
+    f.cursor_col = _cursor_col;
+    f.display_on = _disp_on;
+    f.cursor_on = _cur_on;
+    f.blink_on = _blink;
+
+    char addr[5];
+    snprintf(addr, sizeof(addr), "0x%02x", _addr);
+    // A mirror of what this panel shows, one hop from the I2C bus: never re-displayed
+    LCDJson::Meta m;
+    m.src = _src;
+    m.hop = 1;
+    m.addr = addr;
+    m.has_gen = false;
+    m.fmt = false;
+    _jsonLen = LCDJson::write(_json, sizeof(_json), m, f);
+    _jsonGen = _gen;
+    if (!_jsonLen) return;
   }
-  j += F("]}");
 
   s_udp.beginPacket(IPAddress(255,255,255,255), LCD_MONITOR_UDP_PORT);
-  s_udp.write((const uint8_t*)j.c_str(), j.length());
+  s_udp.write((const uint8_t*)_json, _jsonLen);
   s_udp.endPacket();
   _lastTxMs = millis();
 }
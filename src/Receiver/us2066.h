@@ -1,6 +1,7 @@
 #pragma once
 #include <Arduino.h>
 #include <Wire.h>
+#include "lcd_json.h"
 
 // Match emulator/I2C monitor expectations for control bytes
 static constexpr uint8_t CTRL_CMD  = 0x80;  // control byte for "command"
@@ -50,6 +51,9 @@ public:
   // Row writer (padded/truncated to configured cols)
   void writeRow(uint8_t row, const String& text);
 
+  // Partial row writer: 'len' cells starting at 'col' (one DDRAM set + one data burst)
+  void writeSpan(uint8_t row, uint8_t col, const char* text, uint8_t len);
+
   // Attempts to set drive current (0x00–0xFF). Returns false if not supported/failed.
   bool setContrast(uint8_t level);
   bool supportsContrast() const { return _contrastCapable; }
@@ -60,6 +64,8 @@ public:
   // --- Telemetry (optional, disabled by default) ---
   void enableTelemetry(bool on);
   void setTelemetryIntervalMs(uint32_t ms);  
+  // Source ID tagged on telemetry ("src"); frames are marked "hop":1 so receivers drop them
+  void setTelemetrySource(const char* id);
   void loop();                               
 
   // Helpers
@@ -107,6 +113,11 @@ private:
   uint32_t _lastUpdateMs = 0;
   uint32_t _lastTxMs     = 0;
   uint32_t _txIntervalMs = 1000;
+  char     _src[16] = "";
+  uint32_t _gen = 0;                   // bumped by _touch(); keys the JSON cache
+  uint32_t _jsonGen = 0;
+  size_t   _jsonLen = 0;               // 0 = cache empty
+  char     _json[LCDJson::kMaxSize];
 
   void _touch();                 
   void _broadcast(bool force);   
@@ -0,0 +1,50 @@
+// web_assets.cpp
+
+#include "web_assets.h"
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+#include <string.h>
+
+#include "web_assets_data.h"
+
+namespace WebAssets {
+
+static const char* cacheControl(const Asset& a) {
+    return a.immutable ? "public, max-age=31536000, immutable" : "no-cache";
+}
+
+void send(AsyncWebServerRequest* req, const Asset& a) {
+    if (req->hasHeader("If-None-Match")) {
+        const String inm = req->header("If-None-Match");
+        if (inm == "*" || inm.indexOf(a.etag) >= 0) {
+            auto* res = req->beginResponse(304);
+            res->addHeader("ETag", a.etag);
+            res->addHeader("Cache-Control", cacheControl(a));
+            req->send(res);
+            return;
+        }
+    }
+    // Every browser sends Accept-Encoding: gzip; there is no uncompressed copy to fall back to
+    auto* res = req->beginResponse(200, a.type, a.gz, a.len);
+    res->addHeader("Content-Encoding", "gzip");
+    res->addHeader("ETag", a.etag);
+    res->addHeader("Cache-Control", cacheControl(a));
+    res->addHeader("Vary", "Accept-Encoding");
+    req->send(res);
+}
+
+const Asset* find(const char* path) {
+    for (const Asset& a : kAssets) {
+        if (strcmp(a.path, path) == 0) return &a;
+    }
+    return nullptr;
+}
+
+void begin(AsyncWebServer& server) {
+    for (const Asset& a : kAssets) {
+        const Asset* ap = &a;
+        server.on(a.path, HTTP_GET, [ap](AsyncWebServerRequest* req){ send(req, *ap); });
+    }
+}
+
+} // namespace WebAssets
@@ -0,0 +1,40 @@
+// web_assets.h
+//
+// Static web UI (HTML/CSS/JS) served from flash. The sources live in web/;
+// script/build_web_assets.py gzips them into web_assets_data.h, so a page is sent as
+// the compressed bytes straight out of flash: no String, no heap copy, no runtime
+// compression. Only dynamic data goes through the JSON endpoints.
+// Kept identical in both sketch folders (each has its own web_assets_data.h).
+//
+// Caching: every asset carries a strong ETag (content hash), so a revisit costs a 304.
+// Pages keep fixed URLs and are revalidated (no-cache); CSS/JS have the hash in their
+// URL and are cached for a year as immutable.
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+class AsyncWebServer;
+class AsyncWebServerRequest;
+
+namespace WebAssets {
+
+    struct Asset {
+        const char* path;       // route, e.g. "/" or "/a/emu.1a2b3c4d.js"
+        const char* type;       // Content-Type
+        const uint8_t* gz;      // gzip body in flash
+        size_t len;
+        const char* etag;       // quoted content hash
+        bool immutable;         // hashed URL: never changes
+    };
+
+    // GET routes for every generated asset; call after server.reset()
+    void begin(AsyncWebServer& server);
+
+    // Asset for 'path', nullptr if there is none
+    const Asset* find(const char* path);
+
+    // 304 if If-None-Match holds the asset's ETag, otherwise the gzip body
+    void send(AsyncWebServerRequest* req, const Asset& a);
+}
@@ -0,0 +1,195 @@
+// web_assets_data.h
+//
+// GENERATED by script/build_web_assets.py from src/Receiver/web/ - do not edit.
+// Edit the files in web/ and rerun the script.
+
+#pragma once
+
+#include <Arduino.h>
+
+#include "web_assets.h"
+
+namespace WebAssets {
+
+// index.html: 4554 -> 1519 bytes
+static const uint8_t k_index_html[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xc5, 0x58, 0x5b, 0x6f, 0xdb, 0x36,
+    0x14, 0x7e, 0xcf, 0xaf, 0xe0, 0x14, 0xac, 0x92, 0x07, 0x5b, 0xbe, 0x34, 0xe9, 0x56, 0xc9, 0x16,
+    0xb0, 0xa5, 0x29, 0xd6, 0x61, 0x6b, 0x8a, 0x39, 0xc3, 0x30, 0x0c, 0x7b, 0xa0, 0x24, 0xda, 0xe6,
+    0x42, 0x91, 0x9a, 0x48, 0xc7, 0xf1, 0x8c, 0xfc, 0xf7, 0x1d, 0x5e, 0xe4, 0xc8, 0xb2, 0x9c, 0xb5,
+    0x7d, 0xd8, 0xfc, 0xe0, 0x58, 0xe4, 0xb9, 0x9f, 0xef, 0x7c, 0xa4, 0x32, 0xfd, 0xe2, 0xcd, 0xcd,
+    0xd5, 0xed, 0x6f, 0x1f, 0xae, 0xd1, 0x4a, 0x15, 0x2c, 0x39, 0x9b, 0xd6, 0x7f, 0x08, 0xce, 0x93,
+    0x33, 0x04, 0x9f, 0xa9, 0xa2, 0x8a, 0x91, 0xe4, 0x57, 0xfa, 0x96, 0xa2, 0x39, 0x51, 0xeb, 0x72,
+    0x3a, 0xb4, 0x2b, 0x76, 0xb7, 0x20, 0x0a, 0x23, 0x8e, 0x0b, 0x32, 0xf3, 0xee, 0x29, 0xd9, 0x94,
+    0xa2, 0x52, 0x1e, 0xca, 0x04, 0x57, 0x84, 0xab, 0x99, 0xb7, 0xa1, 0xb9, 0x5a, 0xcd, 0x5e, 0x4e,
+    0x46, 0x7d, 0xca, 0xa9, 0xa2, 0x98, 0x0d, 0x64, 0x86, 0x19, 0x99, 0x8d, 0x3d, 0xa7, 0x2e, 0xd5,
+    0xb6, 0x36, 0xa5, 0x3f, 0xa9, 0xc8, 0xb7, 0x68, 0x97, 0xe2, 0xec, 0x6e, 0x59, 0x89, 0x35, 0xcf,
+    0xa3, 0xf3, 0xf1, 0x78, 0x1c, 0x67, 0x82, 0x89, 0x2a, 0x3a, 0xbf, 0xbe, 0xbe, 0x8e, 0x17, 0x60,
+    0x79, 0xb0, 0xc0, 0x05, 0x65, 0xdb, 0x48, 0x62, 0x2e, 0x07, 0x92, 0x54, 0x74, 0x11, 0x3f, 0xee,
+    0x2d, 0x84, 0xda, 0x37, 0xa6, 0x9c, 0x54, 0x68, 0x57, 0xe0, 0x87, 0x81, 0x89, 0x20, 0x7a, 0x79,
+    0x31, 0x2a, 0x1f, 0xe2, 0x02, 0x57, 0x4b, 0xca, 0xa3, 0xc9, 0x45, 0xf9, 0x80, 0xf0, 0x5a, 0x89,
+    0xb8, 0xe9, 0x68, 0x32, 0x99, 0xc4, 0x25, 0xce, 0x73, 0xca, 0x97, 0xd1, 0x84, 0x14, 0x71, 0x2a,
+    0xaa, 0x9c, 0x54, 0x83, 0x0a, 0xe7, 0x74, 0x2d, 0xa3, 0xf1, 0x04, 0xf4, 0x53, 0xf1, 0x30, 0x90,
+    0x2b, 0x9c, 0x8b, 0x4d, 0x34, 0x42, 0x23, 0x34, 0x7e, 0x05, 0x76, 0xce, 0x47, 0xa3, 0xd1, 0x37,
+    0x0d, 0xff, 0x94, 0x97, 0x6b, 0xd5, 0x97, 0x84, 0x91, 0x4c, 0xf5, 0xd3, 0xb5, 0x52, 0x82, 0xa3,
+    0x9d, 0x0d, 0x62, 0x3c, 0x1a, 0x7d, 0x69, 0x6d, 0xd0, 0xbf, 0xb5, 0x17, 0xe7, 0x01, 0x56, 0xea,
+    0xc8, 0xc2, 0xaf, 0x49, 0x81, 0x46, 0xfb, 0x30, 0xc2, 0x57, 0x10, 0x87, 0xc9, 0x18, 0x34, 0x48,
+    0x34, 0x0e, 0x47, 0x97, 0x47, 0x81, 0x7d, 0x63, 0xe2, 0xd2, 0x2b, 0xd1, 0x18, 0xc2, 0x91, 0x82,
+    0xd1, 0x1c, 0x9d, 0x5f, 0x5e, 0x5e, 0xc6, 0xcf, 0x54, 0xb1, 0x51, 0xae, 0x54, 0xf1, 0x41, 0x59,
+    0x51, 0x08, 0xa0, 0x55, 0xf8, 0xc9, 0xeb, 0xd7, 0x78, 0x92, 0x39, 0xad, 0xcd, 0x8a, 0x2a, 0x52,
+    0x7b, 0x76, 0x86, 0x9c, 0x40, 0xcb, 0x56, 0x8e, 0xf9, 0x52, 0xd7, 0xbe, 0x69, 0x0a, 0x43, 0x69,
+    0x4f, 0xdb, 0xd1, 0xbb, 0x2d, 0x23, 0x02, 0x30, 0x75, 0x18, 0xcc, 0xab, 0x4b, 0x8c, 0x2f, 0x9f,
+    0x0b, 0xc6, 0x0a, 0x34, 0xec, 0x48, 0x85, 0xd5, 0x5a, 0x6a, 0x10, 0xe8, 0xd2, 0x0e, 0x94, 0x28,
+    0xa3, 0xf1, 0x41, 0x39, 0xc3, 0xd7, 0xba, 0x9a, 0x4f, 0x1a, 0x0c, 0xa7, 0x84, 0xa1, 0x5d, 0x4e,
+    0x65, 0xc9, 0xf0, 0x36, 0x4a, 0x99, 0xc8, 0xee, 0xe2, 0x86, 0x76, 0xa8, 0xc5, 0xdd, 0x73, 0x2a,
+    0xa0, 0xb1, 0x45, 0x14, 0x8e, 0x0f, 0x2c, 0x84, 0x95, 0xd8, 0x3c, 0x19, 0x58, 0x30, 0xf2, 0x10,
+    0x2f, 0x31, 0xb8, 0xd5, 0xd8, 0xc3, 0x8c, 0x2e, 0xf9, 0x00, 0x02, 0x2f, 0x64, 0x94, 0xc1, 0x6c,
+    0x90, 0xaa, 0xad, 0x98, 0xa0, 0xaf, 0xd0, 0x4e, 0x2b, 0x45, 0xe3, 0x83, 0x3c, 0x00, 0x48, 0x54,
+    0x83, 0xa8, 0x99, 0x88, 0xee, 0xba, 0x43, 0x89, 0x5d, 0x98, 0xec, 0x61, 0x60, 0x9f, 0x01, 0x0a,
+    0x39, 0x96, 0x2b, 0x02, 0x58, 0xb8, 0xb8, 0xb8, 0x38, 0xb0, 0x57, 0x60, 0x06, 0x69, 0x36, 0xeb,
+    0x00, 0x49, 0xb8, 0x32, 0xa6, 0x69, 0xea, 0x64, 0xa7, 0x43, 0x37, 0x9a, 0xd3, 0xa1, 0xe5, 0x82,
+    0xa9, 0x9e, 0x4d, 0x37, 0xb5, 0x39, 0xbd, 0x47, 0x19, 0xc3, 0x52, 0xce, 0xbc, 0xfd, 0xb8, 0x79,
+    0x4f, 0x53, 0x6c, 0xf6, 0x8d, 0xba, 0x63, 0x00, 0x0b, 0x7d, 0x45, 0x1e, 0xd4, 0xc0, 0xd4, 0xa1,
+    0xae, 0xc0, 0x61, 0x35, 0xa1, 0x98, 0x0d, 0x23, 0x96, 0x1e, 0x4a, 0xcc, 0x6b, 0x4b, 0xcd, 0x41,
+    0xd8, 0x0f, 0xc6, 0x86, 0xd0, 0xe5, 0x4a, 0xc1, 0x28, 0xb1, 0x3c, 0xf6, 0x92, 0xdb, 0x15, 0xa1,
+    0x18, 0xfd, 0x4c, 0x32, 0x42, 0xef, 0x01, 0x84, 0x8e, 0xae, 0xb4, 0x91, 0x46, 0x70, 0x43, 0x88,
+    0x2e, 0x39, 0x3b, 0x0c, 0xd6, 0x25, 0xe3, 0x6a, 0xdd, 0x8e, 0x62, 0x21, 0xaa, 0x02, 0xd1, 0x5c,
+    0x27, 0xb3, 0xa0, 0x6f, 0xe1, 0xc1, 0x43, 0x82, 0xcb, 0x75, 0x5a, 0x50, 0xa0, 0xb8, 0x0a, 0x9c,
+    0x54, 0x1c, 0x2d, 0x30, 0x93, 0x24, 0x6e, 0x69, 0x1a, 0x6d, 0x83, 0x2b, 0xcb, 0x9f, 0xef, 0x89,
+    0xda, 0x88, 0xea, 0x6e, 0x3a, 0xb4, 0x6b, 0xc7, 0xb2, 0x96, 0x37, 0x8c, 0x2f, 0x29, 0x69, 0xfe,
+    0xa6, 0x12, 0x25, 0xb0, 0x0d, 0xf7, 0xea, 0x1a, 0x1c, 0x15, 0xac, 0xcb, 0xa3, 0xb1, 0x24, 0x4a,
+    0x83, 0x9a, 0x7b, 0xcc, 0xd6, 0xa0, 0xe7, 0x25, 0x1f, 0x18, 0xc1, 0x92, 0x20, 0xe7, 0x00, 0x28,
+    0xbb, 0x0e, 0xc5, 0x0a, 0x76, 0xc4, 0x32, 0xb4, 0xb2, 0x1d, 0x3b, 0x86, 0xe3, 0x90, 0xda, 0x96,
+    0x60, 0x59, 0x37, 0xd5, 0xdb, 0x07, 0xec, 0x21, 0x80, 0x7e, 0x46, 0x56, 0xd0, 0x0e, 0x52, 0xcd,
+    0xbc, 0xf9, 0xfc, 0xdd, 0x9b, 0x4f, 0x8b, 0xdd, 0x55, 0xeb, 0x03, 0xb4, 0x03, 0xc2, 0xcb, 0x4f,
+    0x57, 0xaa, 0x19, 0x43, 0xe9, 0xa4, 0x6d, 0x1c, 0xfa, 0xa9, 0x15, 0x87, 0x29, 0x7e, 0x6d, 0xb3,
+    0xcb, 0x6b, 0x03, 0x03, 0x30, 0x8a, 0xa7, 0x6a, 0xea, 0xe8, 0xdc, 0x3a, 0xb5, 0x0f, 0x1a, 0x09,
+    0x19, 0xa3, 0xd9, 0x1d, 0xe4, 0x8f, 0xef, 0x49, 0xd0, 0xf3, 0x6a, 0x3b, 0x0d, 0x62, 0xf5, 0x92,
+    0x2b, 0xc1, 0xb9, 0xae, 0xfb, 0x0b, 0x34, 0x07, 0xa9, 0xe9, 0xd0, 0x2a, 0x7f, 0x96, 0x1b, 0x00,
+    0xe3, 0x92, 0xa8, 0x96, 0x23, 0xcb, 0xba, 0x5e, 0xf2, 0xd6, 0x6c, 0x22, 0x9d, 0xef, 0x69, 0x27,
+    0x6e, 0x02, 0x3e, 0xd1, 0xef, 0x86, 0x72, 0x80, 0x62, 0x08, 0xac, 0x88, 0x35, 0x60, 0x66, 0xfe,
+    0x10, 0x58, 0xda, 0x3f, 0x88, 0x02, 0x16, 0xbc, 0xe4, 0xe6, 0xf6, 0x5b, 0xf4, 0x4b, 0x99, 0x63,
+    0x75, 0x22, 0xcd, 0xe9, 0x50, 0x8f, 0x53, 0x6b, 0xad, 0x39, 0x83, 0x86, 0xb7, 0x1d, 0xa4, 0xec,
+    0xef, 0x64, 0x6e, 0xfe, 0x46, 0x28, 0x0c, 0xc3, 0x56, 0xf0, 0x8d, 0xc7, 0xe6, 0x4f, 0x99, 0x55,
+    0xb4, 0x6c, 0x40, 0x77, 0xb1, 0xe6, 0x96, 0x45, 0xd7, 0x9c, 0xfe, 0x15, 0xe0, 0xaa, 0xea, 0xed,
+    0x90, 0x1b, 0xdc, 0xdf, 0xc1, 0x28, 0x27, 0x1b, 0x4d, 0x16, 0x7a, 0x23, 0x5c, 0x50, 0x06, 0xd4,
+    0x14, 0xc8, 0x59, 0x22, 0xd1, 0x8b, 0x17, 0x48, 0x86, 0x0a, 0x9a, 0x18, 0xf4, 0x42, 0x46, 0xf8,
+    0x52, 0xad, 0x7a, 0xbd, 0x3f, 0x62, 0xd4, 0x38, 0x33, 0xa0, 0xd8, 0x70, 0xa3, 0xe1, 0x1c, 0x88,
+    0x78, 0x66, 0x29, 0xe0, 0xd8, 0xa7, 0x16, 0x08, 0x7a, 0x68, 0x77, 0x90, 0x32, 0x5d, 0xa0, 0xa0,
+    0xd6, 0xec, 0xb9, 0x58, 0xe2, 0x27, 0x5b, 0xaa, 0x5a, 0x37, 0x4c, 0x19, 0x73, 0x44, 0x65, 0xab,
+    0xc0, 0x1f, 0x6a, 0x11, 0xbf, 0x17, 0xaa, 0x15, 0xe1, 0x41, 0x85, 0x66, 0x09, 0xaa, 0xc2, 0x3f,
+    0xa5, 0x00, 0x07, 0x6e, 0x8d, 0x51, 0xa9, 0xf4, 0xf2, 0xee, 0xa8, 0xc1, 0x76, 0xc7, 0x96, 0x40,
+    0xff, 0xee, 0x85, 0x12, 0x6e, 0x6b, 0x41, 0x80, 0xfb, 0x69, 0x6f, 0x96, 0x60, 0xd3, 0x5a, 0x46,
+    0xae, 0x44, 0x51, 0xe2, 0x8a, 0x04, 0x69, 0xaf, 0x17, 0x1f, 0x9b, 0x80, 0x7c, 0x73, 0x47, 0x4a,
+    0x60, 0x2a, 0x17, 0xd9, 0xba, 0x00, 0x2a, 0x0f, 0x01, 0x74, 0xd7, 0x8c, 0xe8, 0x9f, 0xdf, 0x6d,
+    0xdf, 0xe5, 0x81, 0xdf, 0x24, 0x2f, 0xbf, 0xc3, 0x4e, 0x6d, 0x23, 0xa4, 0x30, 0x17, 0xd5, 0xf7,
+    0xb7, 0x3f, 0xfd, 0x08, 0xd6, 0x7c, 0xff, 0x84, 0x43, 0xb2, 0xc0, 0x6b, 0xa6, 0x6e, 0x4a, 0xd5,
+    0x74, 0x99, 0x55, 0x04, 0x30, 0xe6, 0xbc, 0x06, 0xbe, 0xa5, 0xb1, 0x4e, 0x5f, 0x7b, 0xf5, 0xd0,
+    0xb0, 0xe1, 0x09, 0x4f, 0x0d, 0x31, 0xcd, 0x69, 0x5a, 0xea, 0x04, 0x67, 0xfa, 0xcf, 0xe4, 0x83,
+    0xcb, 0x92, 0xf0, 0xfc, 0x6a, 0x45, 0x59, 0x1e, 0x3c, 0x59, 0xec, 0xaa, 0x24, 0x34, 0x20, 0x84,
+    0x49, 0xb8, 0xc6, 0xd0, 0x55, 0x5d, 0xae, 0xee, 0x9e, 0xd5, 0x35, 0x10, 0x9f, 0x99, 0xbc, 0xfe,
+    0x88, 0x46, 0xe6, 0xda, 0xd3, 0x69, 0x29, 0x97, 0xf8, 0x69, 0xa1, 0xce, 0x3c, 0x45, 0x67, 0x82,
+    0x8f, 0xcf, 0xb5, 0x1d, 0x58, 0x65, 0xa5, 0x29, 0x0b, 0x9c, 0xd5, 0x63, 0x72, 0x34, 0x21, 0x7b,
+    0xa5, 0xe7, 0x40, 0x06, 0x93, 0x50, 0xa7, 0xb6, 0x37, 0x6e, 0x16, 0x3a, 0x02, 0x3a, 0x5c, 0x7a,
+    0xec, 0x85, 0xc0, 0x64, 0x50, 0x7c, 0x70, 0xdc, 0x3d, 0x2e, 0xff, 0x07, 0xd6, 0x3f, 0xb7, 0xcf,
+    0xe2, 0x5f, 0xd0, 0xdd, 0xe8, 0xae, 0x3f, 0x07, 0x06, 0x81, 0xfb, 0x0a, 0x65, 0x24, 0xff, 0x58,
+    0x28, 0x1f, 0xb7, 0x18, 0xca, 0xb7, 0xa0, 0x1c, 0xae, 0x92, 0x5b, 0x28, 0xe0, 0x2c, 0xd9, 0xb5,
+    0x69, 0xf0, 0xa0, 0xff, 0x4f, 0x84, 0x29, 0x89, 0x7a, 0xa7, 0xaf, 0x7e, 0x10, 0xab, 0xa1, 0xbf,
+    0x3e, 0x7a, 0x09, 0x2f, 0x50, 0x0d, 0x51, 0x77, 0xcc, 0x08, 0xce, 0x04, 0xce, 0x35, 0x16, 0x41,
+    0x28, 0x3e, 0xeb, 0x20, 0x55, 0x73, 0xda, 0xb6, 0xda, 0x66, 0xe8, 0xd8, 0xcc, 0xd2, 0xc7, 0xa1,
+    0x26, 0x3e, 0xd2, 0xd6, 0x97, 0x87, 0xe7, 0xb4, 0xf5, 0x7e, 0xb7, 0xf6, 0x9e, 0x9f, 0x21, 0x30,
+    0xbf, 0xdf, 0x81, 0x27, 0x78, 0x53, 0x5e, 0x89, 0x3c, 0x02, 0x5a, 0xb9, 0x99, 0xdf, 0xfa, 0xfd,
+    0xa3, 0x7d, 0x7d, 0xcd, 0x26, 0x15, 0x9c, 0x72, 0x3b, 0xff, 0xca, 0xbe, 0x3f, 0x0f, 0x6e, 0xe1,
+    0x28, 0xf6, 0x41, 0x03, 0x5a, 0x01, 0x87, 0xb0, 0x39, 0x77, 0x87, 0x9a, 0xec, 0xfd, 0xc7, 0x63,
+    0x75, 0x7d, 0x3d, 0x8f, 0xd0, 0x0f, 0xf3, 0x9b, 0xf7, 0xf0, 0xea, 0x53, 0x41, 0x23, 0xe8, 0x62,
+    0x1b, 0xec, 0x74, 0xb6, 0x91, 0xfe, 0xea, 0xeb, 0xc8, 0x23, 0xfd, 0xf5, 0xd8, 0x6b, 0x37, 0xb2,
+    0x79, 0x96, 0x68, 0x90, 0xec, 0xcf, 0x92, 0x13, 0x07, 0xc9, 0xe9, 0xda, 0x9a, 0x73, 0x1a, 0xea,
+    0x63, 0xa0, 0x7e, 0x6b, 0xf1, 0xa6, 0xda, 0xc0, 0xe9, 0xc2, 0xc5, 0xbe, 0xaf, 0xf5, 0xf5, 0xa6,
+    0xe5, 0xb6, 0xae, 0xae, 0xdd, 0xf6, 0xff, 0xe3, 0x98, 0x3f, 0x85, 0x86, 0x3a, 0xcf, 0x96, 0x8f,
+    0x81, 0x53, 0x87, 0xee, 0x71, 0xad, 0xe0, 0x56, 0xee, 0xae, 0x36, 0x70, 0xbb, 0x32, 0x2f, 0x64,
+    0xf0, 0x7e, 0x66, 0xfe, 0x65, 0xf3, 0x0f, 0x57, 0x12, 0x77, 0x0d, 0xca, 0x11, 0x00, 0x00,
+};
+
+// ota.html: 2787 -> 1126 bytes
+static const uint8_t k_ota_html[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x56, 0x61, 0x6f, 0xdb, 0x36,
+    0x10, 0xfd, 0xde, 0x5f, 0xc1, 0x2a, 0xc8, 0x64, 0x6f, 0x31, 0x2d, 0xab, 0x75, 0xd6, 0x48, 0x96,
+    0x87, 0x35, 0x4d, 0xb0, 0x61, 0xeb, 0x52, 0x34, 0x29, 0xba, 0xa1, 0xe8, 0x07, 0x5a, 0x3a, 0x59,
+    0x44, 0x25, 0x52, 0xa3, 0xa8, 0xc8, 0x9e, 0xe1, 0xff, 0xbe, 0xa3, 0x24, 0xdb, 0x72, 0x62, 0xa7,
+    0x28, 0x86, 0x09, 0x41, 0xc2, 0x90, 0xef, 0xee, 0x1e, 0xef, 0xdd, 0x9d, 0x34, 0x79, 0xfe, 0xe6,
+    0xe6, 0xf2, 0xee, 0xaf, 0x77, 0x57, 0x24, 0xd1, 0x59, 0x3a, 0x7d, 0x36, 0xd9, 0xfc, 0x01, 0x16,
+    0x4d, 0x9f, 0x11, 0x7c, 0x26, 0x9a, 0xeb, 0x14, 0xa6, 0x37, 0x77, 0x3f, 0x93, 0x0f, 0x79, 0xc4,
+    0x34, 0x4c, 0x86, 0xcd, 0x4e, 0x73, 0x9a, 0x81, 0x66, 0x44, 0xb0, 0x0c, 0x02, 0xeb, 0x9e, 0x43,
+    0x95, 0x4b, 0xa5, 0x2d, 0x12, 0x4a, 0xa1, 0x41, 0xe8, 0xc0, 0xaa, 0x78, 0xa4, 0x93, 0xe0, 0x85,
+    0xeb, 0x9c, 0x71, 0xc1, 0x35, 0x67, 0xe9, 0xa0, 0x08, 0x59, 0x0a, 0xc1, 0xc8, 0x6a, 0xcd, 0x0b,
+    0xbd, 0xdc, 0xb8, 0x32, 0xcf, 0x4c, 0x46, 0x4b, 0xb2, 0x9a, 0xb1, 0xf0, 0xcb, 0x5c, 0xc9, 0x52,
+    0x44, 0xde, 0xc9, 0x68, 0x34, 0xf2, 0x43, 0x99, 0x4a, 0xe5, 0x9d, 0x5c, 0x5d, 0x5d, 0xf9, 0x31,
+    0x7a, 0x1e, 0xc4, 0x2c, 0xe3, 0xe9, 0xd2, 0x2b, 0x98, 0x28, 0x06, 0x05, 0x28, 0x1e, 0xfb, 0xeb,
+    0xad, 0x07, 0x6a, 0x62, 0x33, 0x2e, 0x40, 0x91, 0x55, 0xc6, 0x16, 0x83, 0x9a, 0x81, 0xf7, 0xe2,
+    0xdc, 0xc9, 0x17, 0x7e, 0xc6, 0xd4, 0x9c, 0x0b, 0xcf, 0x7d, 0x99, 0x2f, 0x08, 0x2b, 0xb5, 0xf4,
+    0xbb, 0x81, 0x5c, 0xd7, 0xf5, 0x73, 0x16, 0x45, 0x5c, 0xcc, 0x3d, 0x17, 0x32, 0x7f, 0x26, 0x55,
+    0x04, 0x6a, 0xa0, 0x58, 0xc4, 0xcb, 0xc2, 0x1b, 0xb9, 0x68, 0x3f, 0x93, 0x8b, 0x41, 0x91, 0xb0,
+    0x48, 0x56, 0x9e, 0x43, 0x1c, 0x32, 0x3a, 0x47, 0x3f, 0x27, 0x8e, 0xe3, 0xbc, 0xea, 0xc4, 0xe7,
+    0x22, 0x2f, 0xf5, 0x27, 0xbd, 0xcc, 0x21, 0x88, 0x79, 0x0a, 0x9f, 0xcf, 0x66, 0xa5, 0xd6, 0x52,
+    0x90, 0x55, 0x43, 0x64, 0xe4, 0x38, 0xa7, 0x8d, 0x1f, 0xfe, 0x8f, 0x89, 0xd4, 0x46, 0xc1, 0x9d,
+    0x0d, 0x3b, 0xfa, 0x23, 0x64, 0xc4, 0xd9, 0x52, 0xa1, 0xe7, 0xc8, 0xa5, 0xbe, 0x35, 0x5a, 0x80,
+    0x37, 0xa2, 0xce, 0xf8, 0x11, 0xb9, 0x57, 0x35, 0x37, 0xb3, 0xe3, 0x8d, 0x90, 0x52, 0x21, 0x53,
+    0x1e, 0x91, 0x93, 0xf1, 0x78, 0xec, 0x3f, 0x91, 0xc9, 0x4e, 0xca, 0x66, 0x5a, 0xec, 0x27, 0xdd,
+    0x3d, 0x1f, 0x33, 0x36, 0x6e, 0xd1, 0x55, 0xc2, 0x35, 0x6c, 0x22, 0xb6, 0x0e, 0x5a, 0x40, 0xc7,
+    0x47, 0xa1, 0x99, 0x2e, 0x0b, 0x93, 0x73, 0x73, 0x8b, 0x81, 0x96, 0xb9, 0x37, 0xda, 0x63, 0x4e,
+    0x2f, 0x0c, 0xf1, 0x6e, 0x54, 0xa6, 0x3e, 0x2a, 0x96, 0x3f, 0x96, 0xfb, 0xc8, 0x55, 0x1e, 0x5d,
+    0x59, 0xde, 0x83, 0x8a, 0x53, 0x14, 0x23, 0xe1, 0x51, 0x04, 0xc2, 0x4f, 0x80, 0xcf, 0x13, 0xed,
+    0x19, 0x59, 0xfc, 0x0e, 0x0d, 0x8a, 0x71, 0xf7, 0xc3, 0x92, 0xd5, 0x06, 0x6a, 0xd4, 0x68, 0x84,
+    0xc1, 0x45, 0x03, 0x9a, 0x0c, 0xdb, 0x9a, 0x9c, 0x0c, 0x9b, 0x26, 0x98, 0x98, 0xa2, 0x6c, 0xcb,
+    0x35, 0xe2, 0xf7, 0x24, 0x4c, 0x59, 0x51, 0x04, 0xd6, 0xb6, 0xce, 0xac, 0x5d, 0xf9, 0x4e, 0x12,
+    0x77, 0xaf, 0x51, 0xf0, 0xdf, 0xdd, 0x59, 0x5d, 0x19, 0x84, 0x47, 0x81, 0x15, 0x57, 0x16, 0xa9,
+    0x2b, 0xc4, 0x32, 0x25, 0x62, 0x11, 0x16, 0x86, 0x90, 0x63, 0xb7, 0xd0, 0x19, 0x17, 0x5d, 0x6f,
+    0x6d, 0xe9, 0xb4, 0x01, 0x51, 0x25, 0x8b, 0x48, 0x11, 0xa6, 0x3c, 0xfc, 0x12, 0x58, 0x91, 0xfc,
+    0x90, 0xa7, 0x92, 0x45, 0xbd, 0xbe, 0x35, 0x6d, 0x56, 0xe4, 0x3b, 0x72, 0x8d, 0xc8, 0x64, 0x32,
+    0x6c, 0xec, 0x3a, 0x8e, 0x3a, 0xb4, 0xdb, 0xac, 0x5b, 0xd3, 0x7a, 0xd3, 0xb0, 0xc1, 0x1d, 0xab,
+    0x73, 0x8a, 0x27, 0x43, 0x3c, 0x6a, 0x7f, 0xef, 0xfb, 0x30, 0xf0, 0x3c, 0xd4, 0x5b, 0x78, 0x23,
+    0xba, 0x35, 0x75, 0x4e, 0x8f, 0xa1, 0xa5, 0x66, 0xb7, 0x0d, 0xe8, 0xa1, 0xcd, 0x21, 0x8b, 0x16,
+    0xa2, 0x64, 0xd5, 0x49, 0xc3, 0x57, 0x53, 0x51, 0x71, 0x81, 0x2d, 0x49, 0x53, 0x19, 0x32, 0xcd,
+    0xa5, 0x08, 0xec, 0xa1, 0x6d, 0x91, 0x5a, 0xc4, 0xc0, 0xea, 0x96, 0x23, 0xb6, 0xbd, 0x6f, 0x4d,
+    0x5f, 0x63, 0xb5, 0x11, 0x2d, 0xc9, 0x47, 0x7e, 0xcd, 0xc9, 0x2d, 0xe8, 0x32, 0x7f, 0x9c, 0xb0,
+    0xaf, 0x86, 0x8c, 0x41, 0x87, 0x49, 0xcf, 0x1e, 0x2a, 0x98, 0x49, 0xa9, 0xed, 0xb3, 0x15, 0x8e,
+    0xc1, 0x44, 0x46, 0x9e, 0xfd, 0xee, 0xe6, 0xf6, 0xce, 0x5e, 0xf7, 0xa9, 0x4e, 0x40, 0xf4, 0x7a,
+    0xfd, 0x60, 0xba, 0x8a, 0x64, 0x58, 0x66, 0x38, 0x0c, 0xe9, 0x1c, 0xf4, 0x55, 0x0a, 0x66, 0xf9,
+    0x7a, 0xf9, 0x6b, 0xd4, 0xb3, 0xb7, 0xa9, 0xb1, 0xfb, 0x94, 0x0b, 0x2c, 0xa4, 0x3b, 0x58, 0xe8,
+    0xc0, 0x7e, 0x5f, 0xbb, 0xc4, 0xd6, 0xa7, 0x94, 0xda, 0xfe, 0xba, 0xff, 0xc4, 0x55, 0x1a, 0x28,
+    0xf9, 0x43, 0x56, 0x07, 0x34, 0xdf, 0xa5, 0xb7, 0xbb, 0x2c, 0x42, 0xc5, 0x73, 0xbd, 0x83, 0xc5,
+    0xa5, 0x08, 0x4d, 0xd2, 0xc8, 0xae, 0x9e, 0x56, 0x7b, 0x69, 0xc0, 0x32, 0x2f, 0x34, 0x89, 0x49,
+    0x40, 0x8e, 0x5e, 0x24, 0xae, 0xf0, 0x06, 0xa6, 0x92, 0x8b, 0x4f, 0xce, 0x67, 0x7f, 0xcf, 0x9a,
+    0xc7, 0xbd, 0xe7, 0x71, 0x7f, 0x45, 0x70, 0xe6, 0x2b, 0xdd, 0xb3, 0x2f, 0x13, 0x29, 0x0b, 0x20,
+    0x8c, 0x98, 0x4a, 0x27, 0x31, 0x57, 0x85, 0xb6, 0xfb, 0x3e, 0x51, 0xa8, 0x82, 0x12, 0x3e, 0x59,
+    0x1f, 0x88, 0xbc, 0x48, 0x14, 0xc6, 0x16, 0x50, 0x91, 0x3f, 0xdf, 0xfe, 0xfe, 0x8b, 0xd6, 0xf9,
+    0x7b, 0xf8, 0xbb, 0x84, 0x42, 0xf7, 0xfa, 0xfb, 0x91, 0x10, 0x47, 0x65, 0x8e, 0x49, 0x6f, 0x24,
+    0x38, 0xb3, 0x87, 0x65, 0xdd, 0x84, 0xf6, 0x99, 0x56, 0x25, 0x1c, 0x00, 0x97, 0xf5, 0x75, 0xa9,
+    0x14, 0xb9, 0x92, 0x73, 0x05, 0x45, 0x81, 0x61, 0x7a, 0x60, 0x14, 0xdb, 0x83, 0xb6, 0xb7, 0x00,
+    0x9a, 0x82, 0x98, 0xeb, 0xe4, 0x52, 0x66, 0xd8, 0xc5, 0x6c, 0x96, 0x42, 0xff, 0x31, 0x6e, 0xc7,
+    0x3a, 0x47, 0x67, 0x6f, 0x99, 0x4e, 0x68, 0x3d, 0xd6, 0x7a, 0xc6, 0x1c, 0x83, 0x41, 0x34, 0x04,
+    0xaa, 0x51, 0xf7, 0xb4, 0xff, 0x3d, 0x8e, 0x9e, 0x07, 0xa4, 0x36, 0xcf, 0xd1, 0x3c, 0x63, 0x73,
+    0x62, 0xa2, 0xeb, 0x6a, 0xa0, 0xf5, 0xd0, 0xc2, 0x20, 0x39, 0xf9, 0x81, 0xd8, 0xa7, 0xf6, 0x7f,
+    0xf0, 0xb4, 0x9b, 0xbe, 0xc6, 0xdd, 0x34, 0x40, 0x62, 0xe4, 0x27, 0x62, 0x9f, 0xb8, 0x17, 0x17,
+    0xcc, 0x0d, 0x6d, 0xe2, 0x99, 0x75, 0x3d, 0xee, 0xbf, 0x35, 0x0a, 0x4e, 0x8a, 0x6e, 0x69, 0x3f,
+    0xc5, 0x76, 0x5f, 0xf9, 0xf5, 0x01, 0x69, 0x85, 0xc2, 0x61, 0xbc, 0x34, 0xc3, 0x03, 0xc2, 0x84,
+    0x89, 0x39, 0x18, 0xb9, 0x8e, 0xa9, 0x65, 0x2c, 0x6a, 0xbc, 0x69, 0x30, 0x08, 0x82, 0xe0, 0xe5,
+    0x11, 0xb5, 0x5a, 0x6c, 0x33, 0x93, 0x10, 0xe7, 0xa2, 0x2a, 0x87, 0x91, 0x4f, 0xde, 0xf4, 0x60,
+    0x2b, 0x23, 0x41, 0xbb, 0x9d, 0xcc, 0x21, 0x56, 0x4d, 0x0a, 0x1a, 0x68, 0x33, 0xa1, 0xc9, 0xcd,
+    0x6f, 0xf4, 0x48, 0x32, 0xd7, 0x04, 0x52, 0xec, 0x90, 0xff, 0x81, 0x43, 0x8c, 0x5f, 0x60, 0x45,
+    0x02, 0x11, 0xa9, 0x38, 0x56, 0x4e, 0xfb, 0xba, 0xb6, 0x51, 0x90, 0x5d, 0x02, 0x8e, 0x50, 0xfa,
+    0x36, 0xb5, 0xda, 0x81, 0x21, 0x55, 0xd6, 0xf6, 0xed, 0x35, 0x2e, 0xdf, 0x30, 0xcd, 0x1e, 0x76,
+    0xac, 0x81, 0x50, 0x96, 0x63, 0xcf, 0x9a, 0x19, 0xc2, 0x55, 0x56, 0x31, 0x85, 0xed, 0x4a, 0x62,
+    0xfc, 0xa1, 0xe6, 0x8b, 0xf2, 0x40, 0xd3, 0x16, 0x06, 0x6c, 0x0c, 0x3b, 0x67, 0xdb, 0xd7, 0x76,
+    0x3b, 0xda, 0x70, 0x16, 0xd6, 0x2f, 0x6c, 0x7c, 0xfd, 0xd6, 0xdf, 0xb2, 0xff, 0x02, 0x40, 0xd4,
+    0xf0, 0x4f, 0xe3, 0x0a, 0x00, 0x00,
+};
+
+static const Asset kAssets[] = {
+    {"/", "text/html; charset=utf-8", k_index_html, sizeof(k_index_html), "\"1b442b26347f5d9e\"", false},
+    {"/ota", "text/html; charset=utf-8", k_ota_html, sizeof(k_ota_html), "\"955395855b39150e\"", false},
+};
+
+// 2 files, 7341 bytes, 2645 gzipped
+
+} // namespace WebAssets
@@ -8,6 +8,7 @@
 #include <algorithm>
 #include "esp_wifi.h"
 #include <Update.h>
+#include "web_assets.h"
 
 static AsyncWebServer server(80);
 
@@ -77,174 +78,8 @@ void startPortal() {
 
     server.reset(); 
 
-    server.on("/", HTTP_GET, [](AsyncWebServerRequest *request){
-        String page = R"rawliteral(
-<!DOCTYPE html>
-<html>
-<head>
-    <title>WiFi Setup</title>
-    <meta name="viewport" content="width=320,initial-scale=1">
-    <style>
-        body {background:#111;color:#EEE;font-family:sans-serif;}
-        .container {max-width:340px;margin:24px auto;background:#222;padding:2em;border-radius:12px;box-shadow:0 0 16px #0008;}
-        input,select,button {width:100%;box-sizing:border-box;margin:.7em 0;padding:.6em;font-size:1.05em;border-radius:8px;border:1px solid #555;background:#111;color:#EEE;}
-        .btn-primary {background:#299a2c;color:white;border-color:#299a2c;}
-        .btn-danger {background:#a22;color:white;border-color:#a22;}
-        .btn-ota {background:#265aa5;color:white;border-color:#265aa5;}
-        .status {margin-top:1em;font-size:.95em;}
-        label {display:block;margin-top:.5em;margin-bottom:.1em;}
-        .row {display:flex;gap:10px;align-items:center;}
-        .row > * {flex:1;}
-        .section {margin-top:18px;padding-top:12px;border-top:1px dashed #444;}
-        .small {font-size:.9em;color:#bbb;}
-    </style>
-</head>
-<body>
-    <div class="container">
-        <div style="width:100%;text-align:center;margin-bottom:1em">
-            <span style="font-size:1.6em;font-weight:bold;">Theia Receiver Setup</span>
-        </div>
-
-        <div class="section">
-            <form id="wifiForm" onsubmit="return false;">
-                <label>WiFi Network</label>
-                <select id="ssidDropdown" style="margin-bottom:1em;">
-                    <option value="">Please select a network</option>
-                </select>
-                <input type="text" id="ssid" placeholder="SSID" style="margin-bottom:1em;">
-                <label>Password</label>
-                <input type="password" id="pass" placeholder="WiFi Password">
-                <div class="row">
-                    <button type="button" onclick="save()" class="btn-primary">Connect & Save</button>
-                    <button type="button" onclick="forget()" class="btn-danger">Forget WiFi</button>
-                </div>
-                <button type="button" onclick="window.location='/ota'" class="btn-ota">OTA Update</button>
-            </form>
-            <div class="status" id="status">Status: ...</div>
-        </div>
-    </div>
-    <script>
-        function uniq(arr){ return [...new Set(arr.filter(s=>s && s.trim().length))]; }
-        let scanning=false;
-        function scan() {
-            if (scanning) return; scanning=true;
-            fetch('/scan').then(r => r.json()).then(list => {
-                list = uniq(list).sort((a,b)=>a.localeCompare(b));
-                let dropdown = document.getElementById('ssidDropdown');
-                dropdown.innerHTML = '';
-                let defaultOpt = document.createElement('option');
-                defaultOpt.value = '';
-                defaultOpt.text = 'Please select a network';
-                dropdown.appendChild(defaultOpt);
-                list.forEach(ssid => {
-                    let opt = document.createElement('option');
-                    opt.value = ssid;
-                    opt.text = ssid;
-                    dropdown.appendChild(opt);
-                });
-                dropdown.onchange = function() {
-                    document.getElementById('ssid').value = dropdown.value;
-                };
-            }).catch(() => {
-                let dropdown = document.getElementById('ssidDropdown');
-                dropdown.innerHTML = '';
-                let opt = document.createElement('option');
-                opt.value = '';
-                opt.text = 'Scan failed';
-                dropdown.appendChild(opt);
-            }).finally(()=>{ scanning=false; });
-        }
-        setInterval(scan, 3000);
-        window.onload = scan;
-
-        function save() {
-            let ssid = document.getElementById('ssid').value;
-            let pass = document.getElementById('pass').value;
-            fetch('/save', {
-                method: 'POST',
-                headers: {'Content-Type': 'application/json'},
-                body: JSON.stringify({ssid:ssid,pass:pass})
-            }).then(r => r.text()).then(t => {
-                document.getElementById('status').innerText = t;
-            });
-        }
-        function forget() {
-            fetch('/forget').then(r => r.text()).then(t => {
-                document.getElementById('status').innerText = t;
-                document.getElementById('ssid').value = '';
-                document.getElementById('pass').value = '';
-            });
-        }
-    </script>
-</body>
-</html>
-        )rawliteral";
-        request->send(200, "text/html", page);
-    });
-
-    server.on("/ota", HTTP_GET, [](AsyncWebServerRequest *request){
-        String page = R"rawliteral(
-<!DOCTYPE html>
-<html>
-<head>
-    <title>OTA Update</title>
-    <meta name="viewport" content="width=320,initial-scale=1">
-    <style>
-        body {background:#111;color:#EEE;font-family:sans-serif;}
-        .container {max-width:360px;margin:24px auto;background:#222;padding:2em;border-radius:12px;box-shadow:0 0 16px #0008;}
-        input[type=file],button {width:100%;box-sizing:border-box;margin:.7em 0;padding:.6em;font-size:1.05em;border-radius:8px;border:1px solid #555;background:#111;color:#EEE;}
-        .btn {background:#265aa5;color:white;border-color:#265aa5;}
-        .status {margin-top:1em;font-size:.95em;}
-        .barWrap {background:#111;border:1px solid #555;border-radius:8px;overflow:hidden;height:16px;margin-top:.5em}
-        .bar {height:100%;width:0%;}
-    </style>
-</head>
-<body>
-    <div class="container">
-        <h2>OTA Update</h2>
-        <input id="fw" type="file" accept=".bin">
-        <button class="btn" onclick="doUpload()">Upload & Flash</button>
-        <div class="barWrap"><div id="bar" class="bar"></div></div>
-        <div id="pct" class="status">0%</div>
-        <div id="otaStatus" class="status"></div>
-        <div class="row">
-            <button class="btn" onclick="window.location='/'" style="margin-top:14px;">Back to WiFi Setup</button>
-            <button class="btn" onclick="fetch('/reboot',{method:'POST'}).then(()=>{document.getElementById('otaStatus').innerText='Rebooting...';})" style="margin-top:14px;">Reboot Now</button>
-        </div>
-    </div>
-    <script>
-        function doUpload(){
-            const f = document.getElementById('fw').files[0];
-            if(!f){ alert('Choose a .bin first'); return; }
-            const xhr = new XMLHttpRequest();
-            xhr.open('POST','/update',true);
-            xhr.upload.onprogress = (e)=>{
-                if(e.lengthComputable){
-                    const p = Math.round((e.loaded/e.total)*100);
-                    document.getElementById('bar').style.width = p + '%';
-                    document.getElementById('bar').style.background = p>=100 ? '#299a2c' : '#265aa5';
-                    document.getElementById('pct').innerText = p + '%';
-                }
-            };
-            xhr.onreadystatechange = ()=>{
-                if(xhr.readyState===4){
-                    if(xhr.status===200){
-                        document.getElementById('otaStatus').innerText = 'Upload complete. Flash OK.';
-                    } else {
-                        document.getElementById('otaStatus').innerText = 'Upload finished with status ' + xhr.status;
-                    }
-                }
-            };
-            const form = new FormData();
-            form.append('firmware', f, f.name);
-            xhr.send(form);
-        }
-    </script>
-</body>
-</html>
-        )rawliteral";
-        request->send(200, "text/html", page);
-    });
+    // Portal and OTA pages: gzip from flash (web/, script/build_web_assets.py)
+    WebAssets::begin(server);
 
     server.on("/update", HTTP_POST,
         [](AsyncWebServerRequest *request){
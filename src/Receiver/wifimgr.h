@@ -1,10 +1,11 @@
 #pragma once
 
 #include <Arduino.h>
+#include <ESPAsyncWebServer.h>
 
 namespace WiFiMgr {
 
-    //AsyncWebServer& getServer();
+    AsyncWebServer& getServer();
 
     void begin();
     void loop();
@@ -3,6 +3,8 @@
 #include <Wire.h>
 #include "lcd_monitor.h"
 #include "web_emu.h"
+#include "dlog.h"
+#include "net_egress.h"
 #include <ESPmDNS.h>
 
 // ====== Hardware pins ======
@@ -20,11 +22,13 @@ void setup() {
 
   Serial.begin(115200);
   delay(150); // let USB CDC settle a bit
+  DLog::begin();
 
   WiFiMgr::begin();
 
   LCDMonitor::begin(I2C_SDA_PIN, I2C_SCL_PIN);
   WebEmu::begin();
+  NetEgress::begin();
 
   Serial.println("[Main] Thiea OLED Emulator started.");
 }
@@ -45,9 +49,7 @@ void loop() {
         }
     }
 
-  if (WiFiMgr::isConnected()) {
-    LCDMonitor::loop();
-  }
-  WebEmu::loop();
+  // I2C decoding and UDP/SSE output run in their own tasks (lcd_decode, lcd_egress)
+  LCDMonitor::loop();
   delay(1);
 }
@@ -0,0 +1,136 @@
+// dlog.cpp
+//
+// Bounded multi-producer / single-consumer record ring (per-slot sequence numbers)
+// drained by a low-priority task that does all printf formatting off the hot path.
+
+#include "dlog.h"
+#include <Arduino.h>
+#include <atomic>
+
+static_assert((DLOG_RING_SIZE & (DLOG_RING_SIZE - 1)) == 0, "DLOG_RING_SIZE must be a power of two");
+
+namespace {
+
+    struct Record {
+        std::atomic<uint32_t> seq;
+        uint32_t ts_ms;
+        uint32_t args[3];
+        uint8_t  level;
+        uint8_t  event;
+    };
+
+    const char* const kFormats[] = {
+#define DLOG_FMT(name, fmt) fmt,
+        DLOG_EVENTS(DLOG_FMT)
+#undef DLOG_FMT
+    };
+    static_assert(sizeof(kFormats) / sizeof(kFormats[0]) == (size_t)DLogEvent::Count,
+                  "DLOG_EVENTS table out of sync");
+
+    const char kLevelTag[] = { '-', 'E', 'W', 'I', 'D', 'T' };
+
+    Record ring[DLOG_RING_SIZE];
+    std::atomic<uint32_t> enqueue_pos{0};
+    std::atomic<uint32_t> dequeue_pos{0};     // advanced by the drain task only
+
+    std::atomic<uint32_t> stat_written{0};
+    std::atomic<uint32_t> stat_dropped{0};
+    std::atomic<uint16_t> stat_high_water{0};
+
+    TaskHandle_t drain_task = nullptr;
+    bool begun = false;
+
+    // Drain task: format and print everything queued, then report any drops.
+    void drainTask(void*) {
+        uint32_t dropped_reported = 0;
+        char line[160];
+
+        for (;;) {
+            for (;;) {
+                const uint32_t pos = dequeue_pos.load(std::memory_order_relaxed);
+                Record& r = ring[pos & (DLOG_RING_SIZE - 1)];
+                if (r.seq.load(std::memory_order_acquire) != pos + 1) break;
+
+                const uint8_t ev = r.event;
+                const uint8_t lvl = r.level;
+                int n = snprintf(line, sizeof(line), "%7u %c ", (unsigned)r.ts_ms,
+                                 kLevelTag[lvl < sizeof(kLevelTag) ? lvl : 0]);
+                if (ev < (uint8_t)DLogEvent::Count) {
+                    n += snprintf(line + n, sizeof(line) - n, kFormats[ev],
+                                  (unsigned)r.args[0], (unsigned)r.args[1], (unsigned)r.args[2]);
+                }
+                r.seq.store(pos + DLOG_RING_SIZE, std::memory_order_release);
+                dequeue_pos.store(pos + 1, std::memory_order_relaxed);
+
+                if (n > (int)sizeof(line) - 2) n = sizeof(line) - 2;
+                line[n++] = '\n';
+                Serial.write((const uint8_t*)line, n);
+            }
+
+            const uint32_t dropped = stat_dropped.load(std::memory_order_relaxed);
+            if (dropped != dropped_reported) {
+                Serial.printf("[LOG] %u record(s) dropped (total %u)\n",
+                              (unsigned)(dropped - dropped_reported), (unsigned)dropped);
+                dropped_reported = dropped;
+            }
+
+            vTaskDelay(pdMS_TO_TICKS(10));
+        }
+    }
+}
+
+namespace DLog {
+
+    void begin() {
+        if (begun) return;
+        for (uint32_t i = 0; i < DLOG_RING_SIZE; ++i) {
+            ring[i].seq.store(i, std::memory_order_relaxed);
+        }
+        begun = true;
+        // Lowest application priority: formatting never competes with capture or WiFi
+        xTaskCreatePinnedToCore(drainTask, "dlog", 3072, nullptr, tskIDLE_PRIORITY + 1,
+                                &drain_task, tskNO_AFFINITY);
+    }
+
+    void IRAM_ATTR write(uint8_t level, DLogEvent ev, uint32_t a0, uint32_t a1, uint32_t a2) {
+        if (!begun) return;
+
+        uint32_t pos = enqueue_pos.load(std::memory_order_relaxed);
+        Record* r;
+        for (;;) {
+            r = &ring[pos & (DLOG_RING_SIZE - 1)];
+            const uint32_t seq = r->seq.load(std::memory_order_acquire);
+            const int32_t dif = (int32_t)(seq - pos);
+            if (dif == 0) {
+                if (enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (dif < 0) {
+                stat_dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            } else {
+                pos = enqueue_pos.load(std::memory_order_relaxed);
+            }
+        }
+
+        r->ts_ms = millis();
+        r->args[0] = a0;
+        r->args[1] = a1;
+        r->args[2] = a2;
+        r->level = level;
+        r->event = (uint8_t)ev;
+        r->seq.store(pos + 1, std::memory_order_release);
+
+        stat_written.fetch_add(1, std::memory_order_relaxed);
+        const uint32_t depth = pos + 1 - dequeue_pos.load(std::memory_order_relaxed);
+        if (depth <= DLOG_RING_SIZE && depth > stat_high_water.load(std::memory_order_relaxed)) {
+            stat_high_water.store((uint16_t)depth, std::memory_order_relaxed);
+        }
+    }
+
+    Stats getStats() {
+        Stats st;
+        st.written    = stat_written.load(std::memory_order_relaxed);
+        st.dropped    = stat_dropped.load(std::memory_order_relaxed);
+        st.high_water = stat_high_water.load(std::memory_order_relaxed);
+        return st;
+    }
+}
@@ -0,0 +1,97 @@
+// dlog.h
+//
+// Deferred binary logging for the I2C/LCD hot path.
+// Call sites store only an event ID plus up to three raw 32-bit arguments into a
+// lock-free ring; a low-priority task formats and drains the records to USB-CDC.
+// Levels above DLOG_LEVEL compile to nothing.
+
+#pragma once
+
+#include <stdint.h>
+
+#define DLOG_LEVEL_OFF    0
+#define DLOG_LEVEL_ERROR  1
+#define DLOG_LEVEL_WARN   2
+#define DLOG_LEVEL_INFO   3
+#define DLOG_LEVEL_DEBUG  4
+#define DLOG_LEVEL_TRACE  5
+
+// Compile-time verbosity. Build with -DDLOG_LEVEL=5 for full per-byte I2C traces.
+#ifndef DLOG_LEVEL
+#define DLOG_LEVEL DLOG_LEVEL_DEBUG
+#endif
+
+// Record ring depth (power of two)
+#ifndef DLOG_RING_SIZE
+#define DLOG_RING_SIZE 256
+#endif
+
+// Event table: X(name, printf format). Arguments are passed as uint32_t.
+#define DLOG_EVENTS(X) \
+    X(LcdControl,        "[LCD] Control: 0x%02X (Co=%u D/C=%u)") \
+    X(LcdChar,           "[LCD] '%c' at DDRAM 0x%02X") \
+    X(LcdCmdClear,       "[LCD] CMD: 0x%02X (Clear)") \
+    X(LcdCmdHome,        "[LCD] CMD: 0x%02X (Home)") \
+    X(LcdCmdDdram,       "[LCD] CMD: DDRAM 0x%02X") \
+    X(LcdCmdDisplay,     "[LCD] CMD: 0x%02X (Display: %u)") \
+    X(LcdCmdShift,       "[LCD] CMD: 0x%02X (Shift: offset %u, AC 0x%02X)") \
+    X(LcdCmdOther,       "[LCD] CMD: 0x%02X (op %u, page %u)") \
+    X(LcdReservedControl,"[LCD] Control byte 0x%02X has reserved bits set") \
+    X(LcdLoneControl,    "[LCD] WARNING: Control byte 0x%02X without payload") \
+    X(LcdStatusRead,     "[LCD] Status: 0x%02X") \
+    X(LcdCaptureDrop,    "[LCD] Capture ring overflow: %u transaction(s) dropped (total %u)")
+
+enum class DLogEvent : uint8_t {
+#define DLOG_ENUM(name, fmt) name,
+    DLOG_EVENTS(DLOG_ENUM)
+#undef DLOG_ENUM
+    Count
+};
+
+namespace DLog {
+
+    struct Stats {
+        uint32_t written = 0;     // records accepted into the ring
+        uint32_t dropped = 0;     // records lost because the ring was full
+        uint16_t high_water = 0;  // deepest ring occupancy seen
+        uint16_t capacity = DLOG_RING_SIZE;
+    };
+
+    // Start the drain task. Call once after Serial.begin().
+    void begin();
+
+    // Store one record. Lock-free, safe from any task; never blocks or formats.
+    void write(uint8_t level, DLogEvent ev, uint32_t a0 = 0, uint32_t a1 = 0, uint32_t a2 = 0);
+
+    Stats getStats();
+}
+
+#if DLOG_LEVEL >= DLOG_LEVEL_ERROR
+#define DLOG_E(ev, ...) DLog::write(DLOG_LEVEL_ERROR, DLogEvent::ev, ##__VA_ARGS__)
+#else
+#define DLOG_E(ev, ...) do {} while (0)
+#endif
+
+#if DLOG_LEVEL >= DLOG_LEVEL_WARN
+#define DLOG_W(ev, ...) DLog::write(DLOG_LEVEL_WARN, DLogEvent::ev, ##__VA_ARGS__)
+#else
+#define DLOG_W(ev, ...) do {} while (0)
+#endif
+
+#if DLOG_LEVEL >= DLOG_LEVEL_INFO
+#define DLOG_I(ev, ...) DLog::write(DLOG_LEVEL_INFO, DLogEvent::ev, ##__VA_ARGS__)
+#else
+#define DLOG_I(ev, ...) do {} while (0)
+#endif
+
+#if DLOG_LEVEL >= DLOG_LEVEL_DEBUG
+#define DLOG_D(ev, ...) DLog::write(DLOG_LEVEL_DEBUG, DLogEvent::ev, ##__VA_ARGS__)
+#else
+#define DLOG_D(ev, ...) do {} while (0)
+#endif
+
+#if DLOG_LEVEL >= DLOG_LEVEL_TRACE
+#define DLOG_T(ev, ...) DLog::write(DLOG_LEVEL_TRACE, DLogEvent::ev, ##__VA_ARGS__)
+#else
+#define DLOG_T(ev, ...) do {} while (0)
+#endif
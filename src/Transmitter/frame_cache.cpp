@@ -0,0 +1,67 @@
+// frame_cache.cpp
+
+#include "frame_cache.h"
+#include <Arduino.h>
+#include <string.h>
+
+#include "net_egress.h"
+
+namespace FrameCache {
+
+static char cache_buf[LCDJson::kMaxSize];
+static size_t cache_len = 0;            // 0 = empty
+static uint32_t cache_gen = 0;
+static uint32_t stat_encoded = 0;
+static uint32_t stat_reused = 0;
+static portMUX_TYPE cache_mux = portMUX_INITIALIZER_UNLOCKED;
+
+void toFrame(const LCDMonitor::DisplayFrame& in, LCDFrame::Frame& out) {
+    memcpy(out.rows, in.rows, sizeof(out.rows));
+    out.cursor_row = in.cursor_row;
+    out.cursor_col = in.cursor_col;
+    out.display_on = in.display_on;
+    out.cursor_on = in.cursor_on;
+    out.blink_on = in.blink_on;
+}
+
+size_t json(const LCDMonitor::DisplayFrame& frame, char* out, size_t cap) {
+    size_t len = 0;
+    portENTER_CRITICAL(&cache_mux);
+    if (cache_len && cache_gen == frame.generation && cache_len < cap) {
+        memcpy(out, cache_buf, cache_len + 1);
+        len = cache_len;
+        stat_reused++;
+    }
+    portEXIT_CRITICAL(&cache_mux);
+    if (len) return len;
+
+    LCDFrame::Frame f;
+    toFrame(frame, f);
+    LCDJson::Meta m;
+    m.src = NetEgress::deviceId();
+    m.gen = frame.generation;
+    len = LCDJson::write(out, cap, m, f);
+    if (!len) return 0;
+
+    // A slower reader may finish after a newer generation was cached; keep the newer one
+    portENTER_CRITICAL(&cache_mux);
+    stat_encoded++;
+    if (!cache_len || (int32_t)(frame.generation - cache_gen) > 0) {
+        memcpy(cache_buf, out, len + 1);
+        cache_len = len;
+        cache_gen = frame.generation;
+    }
+    portEXIT_CRITICAL(&cache_mux);
+    return len;
+}
+
+Stats getStats() {
+    Stats st;
+    portENTER_CRITICAL(&cache_mux);
+    st.encoded = stat_encoded;
+    st.reused = stat_reused;
+    portEXIT_CRITICAL(&cache_mux);
+    return st;
+}
+
+} // namespace FrameCache
@@ -0,0 +1,32 @@
+// frame_cache.h
+//
+// Serialize-once cache for the JSON frame. UDP (net_egress), the SSE push and new SSE
+// clients, and /emu/state all ask for the same display generation; the first caller
+// encodes it with LCDJson, everyone after copies the cached bytes. Safe from any task
+// (egress task, async_tcp): the cache is swapped under a spinlock, encoding runs outside it.
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "lcd_monitor.h"
+#include "lcd_frame.h"
+#include "lcd_json.h"
+
+namespace FrameCache {
+
+    struct Stats {
+        uint32_t encoded = 0;   // frames serialized
+        uint32_t reused = 0;    // requests served from the cache
+    };
+
+    // JSON for 'frame' (src, hop 0, gen, fmt) into 'out' (NUL-terminated). Returns the
+    // length, 0 if 'cap' is smaller than the frame. Pass at least LCDJson::kMaxSize.
+    size_t json(const LCDMonitor::DisplayFrame& frame, char* out, size_t cap);
+
+    // Binary-codec view of a snapshot
+    void toFrame(const LCDMonitor::DisplayFrame& in, LCDFrame::Frame& out);
+
+    Stats getStats();
+}
@@ -0,0 +1,265 @@
+// frame_transport.cpp
+
+#include "frame_transport.h"
+#include <stdio.h>
+
+#ifdef ARDUINO
+#include <esp_now.h>
+#include <esp_wifi.h>
+#include <lwip/sockets.h>
+#include <freertos/FreeRTOS.h>
+#endif
+
+namespace FrameTransport {
+
+#ifdef ARDUINO
+
+// ---------------- UDP ----------------
+
+Endpoint UdpLink::endpoint(const IPAddress& ip, uint16_t port) {
+    Endpoint e;
+    for (int i = 0; i < 4; i++) e.addr[i] = ip[i];
+    e.port = port;
+    return e;
+}
+
+IPAddress UdpLink::ip(const Endpoint& e) {
+    return IPAddress(e.addr[0], e.addr[1], e.addr[2], e.addr[3]);
+}
+
+bool UdpLink::begin() {
+    if (begun_) return true;
+    joined_ = (uint32_t)join_group_ != 0 && udp_.beginMulticast(join_group_, port_);
+    if (!joined_ && !udp_.begin(port_)) return false;
+    begun_ = true;
+    return true;
+}
+
+void UdpLink::end() {
+    udp_.stop();
+    begun_ = false;
+    joined_ = false;
+}
+
+bool UdpLink::sendTo(const Endpoint& to, const uint8_t* data, size_t len) {
+    if (!begun_) return false;
+    udp_.beginPacket(ip(to), to.port);
+    udp_.write(data, len);
+    return udp_.endPacket() != 0;
+}
+
+void UdpLink::setMulticast(bool on, const uint8_t group[4], uint8_t ttl) {
+    mcast_on_ = on;
+    memcpy(group_, group, sizeof(group_));
+    ttl_ = ttl;
+    if (mcast_fd_ >= 0) {
+        setsockopt(mcast_fd_, IPPROTO_IP, IP_MULTICAST_TTL, &ttl_, sizeof(ttl_));
+    }
+}
+
+bool UdpLink::broadcast(const uint8_t* data, size_t len) {
+    if (!mcast_on_) {
+        Endpoint all;
+        memset(all.addr, 0xFF, 4);
+        all.port = port_;
+        return sendTo(all, data, len);
+    }
+    if (mcast_fd_ < 0) {
+        mcast_fd_ = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+        if (mcast_fd_ < 0) return false;
+        const uint8_t loop = 0;
+        setsockopt(mcast_fd_, IPPROTO_IP, IP_MULTICAST_LOOP, &loop, sizeof(loop));
+        setsockopt(mcast_fd_, IPPROTO_IP, IP_MULTICAST_TTL, &ttl_, sizeof(ttl_));
+    }
+    sockaddr_in to = {};
+    to.sin_family = AF_INET;
+    to.sin_port = htons(port_);
+    memcpy(&to.sin_addr.s_addr, group_, 4);
+    return sendto(mcast_fd_, data, len, 0, (const sockaddr*)&to, sizeof(to)) >= 0;
+}
+
+size_t UdpLink::receive(uint8_t* buf, size_t cap, Endpoint& from) {
+    if (!begun_) return 0;
+    while (udp_.parsePacket() > 0) {
+        const int len = udp_.read(buf, cap);
+        if (len <= 0) continue;
+        from = endpoint(udp_.remoteIP(), udp_.remotePort());
+        return (size_t)len;
+    }
+    return 0;
+}
+
+void UdpLink::format(const Endpoint& e, char* out, size_t cap) const {
+    snprintf(out, cap, "%u.%u.%u.%u:%u", e.addr[0], e.addr[1], e.addr[2], e.addr[3], (unsigned)e.port);
+}
+
+// ---------------- ESP-NOW ----------------
+
+namespace {
+
+    const uint8_t kBroadcastMac[ESP_NOW_ETH_ALEN] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+
+    // Filled by the receive callback on the WiFi task, drained by the link's owner
+    struct RxSlot {
+        uint8_t mac[ESP_NOW_ETH_ALEN];
+        uint8_t len;
+        uint8_t data[ESP_NOW_MAX_DATA_LEN];
+    };
+    const uint8_t kRxSlots = 8;
+    RxSlot rx_ring[kRxSlots];
+    uint8_t rx_head = 0, rx_count = 0;
+    uint32_t rx_dropped = 0;
+    portMUX_TYPE rx_mux = portMUX_INITIALIZER_UNLOCKED;
+
+    void onEspNowRecv(const esp_now_recv_info_t* info, const uint8_t* data, int len) {
+        if (!info || !data || len <= 0 || len > ESP_NOW_MAX_DATA_LEN) return;
+        portENTER_CRITICAL(&rx_mux);
+        if (rx_count == kRxSlots) {
+            rx_dropped++;
+        } else {
+            RxSlot& s = rx_ring[(rx_head + rx_count) % kRxSlots];
+            memcpy(s.mac, info->src_addr, ESP_NOW_ETH_ALEN);
+            s.len = (uint8_t)len;
+            memcpy(s.data, data, len);
+            rx_count++;
+        }
+        portEXIT_CRITICAL(&rx_mux);
+    }
+
+    // ESP-NOW rides on whichever interface is up: the station, or the portal AP
+    wifi_interface_t espNowIf() {
+        wifi_mode_t mode = WIFI_MODE_NULL;
+        esp_wifi_get_mode(&mode);
+        return mode == WIFI_MODE_AP ? WIFI_IF_AP : WIFI_IF_STA;
+    }
+
+} // namespace
+
+size_t EspNowLink::mtu() const {
+    return ESP_NOW_MAX_DATA_LEN;
+}
+
+bool EspNowLink::begin() {
+    if (begun_) return true;
+    if (esp_now_init() != ESP_OK) return false;
+    esp_now_register_recv_cb(onEspNowRecv);
+    if (!addPeer(kBroadcastMac)) {
+        esp_now_deinit();
+        return false;
+    }
+    begun_ = true;
+    return true;
+}
+
+void EspNowLink::end() {
+    if (!begun_) return;
+    esp_now_unregister_recv_cb();
+    esp_now_deinit();       // also drops every peer
+    portENTER_CRITICAL(&rx_mux);
+    rx_count = 0;
+    portEXIT_CRITICAL(&rx_mux);
+    begun_ = false;
+}
+
+// Peers are added on first send; channel 0 = the interface's current channel
+bool EspNowLink::addPeer(const uint8_t mac[6]) {
+    if (esp_now_is_peer_exist(mac)) return true;
+    esp_now_peer_info_t peer = {};
+    memcpy(peer.peer_addr, mac, ESP_NOW_ETH_ALEN);
+    peer.channel = 0;
+    peer.ifidx = espNowIf();
+    peer.encrypt = false;
+    return esp_now_add_peer(&peer) == ESP_OK;
+}
+
+bool EspNowLink::sendTo(const Endpoint& to, const uint8_t* data, size_t len) {
+    if (!begun_ || len > ESP_NOW_MAX_DATA_LEN || !addPeer(to.addr)) return false;
+    return esp_now_send(to.addr, data, len) == ESP_OK;
+}
+
+bool EspNowLink::broadcast(const uint8_t* data, size_t len) {
+    if (!begun_ || len > ESP_NOW_MAX_DATA_LEN) return false;
+    return esp_now_send(kBroadcastMac, data, len) == ESP_OK;
+}
+
+size_t EspNowLink::receive(uint8_t* buf, size_t cap, Endpoint& from) {
+    if (!begun_) return 0;
+    size_t len = 0;
+    portENTER_CRITICAL(&rx_mux);
+    if (rx_count) {
+        const RxSlot& s = rx_ring[rx_head];
+        from = Endpoint();
+        memcpy(from.addr, s.mac, ESP_NOW_ETH_ALEN);
+        len = s.len < cap ? s.len : cap;
+        memcpy(buf, s.data, len);
+        rx_head = (rx_head + 1) % kRxSlots;
+        rx_count--;
+    }
+    portEXIT_CRITICAL(&rx_mux);
+    return len;
+}
+
+void EspNowLink::forget(const Endpoint& e) {
+    if (begun_ && esp_now_is_peer_exist(e.addr)) esp_now_del_peer(e.addr);
+}
+
+void EspNowLink::format(const Endpoint& e, char* out, size_t cap) const {
+    snprintf(out, cap, "%02x:%02x:%02x:%02x:%02x:%02x",
+             e.addr[0], e.addr[1], e.addr[2], e.addr[3], e.addr[4], e.addr[5]);
+}
+
+uint32_t EspNowLink::dropped() const {
+    portENTER_CRITICAL(&rx_mux);
+    const uint32_t n = rx_dropped;
+    portEXIT_CRITICAL(&rx_mux);
+    return n;
+}
+
+#endif // ARDUINO
+
+// ---------------- Loopback ----------------
+
+void LoopbackLink::pair(LoopbackLink& a, LoopbackLink& b) {
+    a.peer_ = &b;
+    b.peer_ = &a;
+}
+
+bool LoopbackLink::push(const Endpoint& from, const uint8_t* data, size_t len) {
+    if (!begun_ || len > kMtu) return false;
+    if (count_ == kSlots) {
+        dropped_++;
+        return false;
+    }
+    Slot& s = slots_[(head_ + count_) % kSlots];
+    s.from = from;
+    s.len = len;
+    memcpy(s.data, data, len);
+    count_++;
+    return true;
+}
+
+bool LoopbackLink::sendTo(const Endpoint& to, const uint8_t* data, size_t len) {
+    if (!begun_ || !peer_ || to != peer_->self_) return false;
+    return peer_->push(self_, data, len);
+}
+
+bool LoopbackLink::broadcast(const uint8_t* data, size_t len) {
+    return begun_ && peer_ && peer_->push(self_, data, len);
+}
+
+size_t LoopbackLink::receive(uint8_t* buf, size_t cap, Endpoint& from) {
+    if (!count_) return 0;
+    const Slot& s = slots_[head_];
+    from = s.from;
+    const size_t len = s.len < cap ? s.len : cap;
+    memcpy(buf, s.data, len);
+    head_ = (head_ + 1) % kSlots;
+    count_--;
+    return len;
+}
+
+void LoopbackLink::format(const Endpoint& e, char* out, size_t cap) const {
+    snprintf(out, cap, "loop:%u", e.addr[0]);
+}
+
+} // namespace FrameTransport
@@ -0,0 +1,166 @@
+// frame_transport.h
+//
+// Links LCD frames travel on, behind one interface shared by the Transmitter (net_egress)
+// and the Receiver sketch. Kept identical in both sketch folders, like lcd_frame.h.
+//
+//   UdpLink       WiFiUDP on the LAN (port 35182): broadcast or multicast to everyone,
+//                 unicast to subscribers. Two WiFi hops through the AP.
+//   EspNowLink    ESP-NOW, station to station with no AP hop. Both ends must be on the same
+//                 channel (joined to the same AP, or one in portal mode on the other's
+//                 channel). Packets are at most 250 bytes, so it carries binary frames only;
+//                 receivers find the sender by broadcasting TYPE_JOIN.
+//   LoopbackLink  two paired in-process endpoints. Needs no Arduino core, so the whole
+//                 encode -> link -> decode path can be run and timed on a host
+//                 (script/loopback_bench.cpp).
+//
+// A link is driven by one task; only EspNowLink's receive queue is filled from another
+// (the WiFi task) and locks internally.
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#include <WiFiUdp.h>
+#endif
+
+namespace FrameTransport {
+
+    // A peer on some link: IPv4 address in addr[0..3] plus port (UDP), a MAC (ESP-NOW),
+    // or addr[0] = endpoint id (loopback)
+    struct Endpoint {
+        uint8_t addr[6] = {0, 0, 0, 0, 0, 0};
+        uint16_t port = 0;
+
+        bool operator==(const Endpoint& o) const { return port == o.port && sameHost(o); }
+        bool operator!=(const Endpoint& o) const { return !(*this == o); }
+        // Same device, any port (UDP multicast leaves from another port than unicast)
+        bool sameHost(const Endpoint& o) const { return memcmp(addr, o.addr, sizeof(addr)) == 0; }
+    };
+
+    class Link {
+    public:
+        virtual ~Link() {}
+
+        virtual const char* name() const = 0;
+        virtual size_t mtu() const = 0;             // largest packet the link carries
+        virtual bool begin() = 0;                   // idempotent
+        virtual void end() = 0;
+        virtual bool ready() const = 0;             // begun
+
+        virtual bool sendTo(const Endpoint& to, const uint8_t* data, size_t len) = 0;
+        virtual bool broadcast(const uint8_t* data, size_t len) = 0;
+
+        // Take the next received packet. Returns its length (truncated to 'cap'), 0 if none.
+        virtual size_t receive(uint8_t* buf, size_t cap, Endpoint& from) = 0;
+
+        // A peer is gone (unsubscribed); links with a peer table drop it
+        virtual void forget(const Endpoint&) {}
+
+        // Human-readable endpoint for logs and status pages
+        virtual void format(const Endpoint& e, char* out, size_t cap) const = 0;
+    };
+
+#ifdef ARDUINO
+    class UdpLink : public Link {
+    public:
+        explicit UdpLink(uint16_t port) : port_(port) {}
+
+        const char* name() const override { return "udp"; }
+        size_t mtu() const override { return 1472; }
+        bool begin() override;
+        void end() override;
+        bool ready() const override { return begun_; }
+        bool sendTo(const Endpoint& to, const uint8_t* data, size_t len) override;
+        bool broadcast(const uint8_t* data, size_t len) override;
+        size_t receive(uint8_t* buf, size_t cap, Endpoint& from) override;
+        void format(const Endpoint& e, char* out, size_t cap) const override;
+
+        // Receive side: IGMP-join 'group' on the next begin() (0.0.0.0 = none)
+        void setJoinGroup(const IPAddress& group) { join_group_ = group; }
+        bool joined() const { return joined_; }
+
+        // Send side: broadcast() goes to 'group' with 'ttl' instead of 255.255.255.255. Uses
+        // its own lwIP socket (WiFiUDP sets neither the TTL nor loopback) from an ephemeral port.
+        void setMulticast(bool on, const uint8_t group[4], uint8_t ttl);
+        bool multicast() const { return mcast_on_; }
+
+        uint16_t port() const { return port_; }
+        static Endpoint endpoint(const IPAddress& ip, uint16_t port);
+        static IPAddress ip(const Endpoint& e);
+
+    private:
+        WiFiUDP udp_;
+        uint16_t port_;
+        bool begun_ = false;
+        IPAddress join_group_;
+        bool joined_ = false;
+        bool mcast_on_ = false;
+        uint8_t group_[4] = {0, 0, 0, 0};
+        uint8_t ttl_ = 1;
+        int mcast_fd_ = -1;
+    };
+
+    // One instance per device: the ESP-NOW receive callback has no user context
+    class EspNowLink : public Link {
+    public:
+        const char* name() const override { return "espnow"; }
+        size_t mtu() const override;
+        bool begin() override;                      // after WiFi is started (any mode)
+        void end() override;
+        bool ready() const override { return begun_; }
+        bool sendTo(const Endpoint& to, const uint8_t* data, size_t len) override;
+        bool broadcast(const uint8_t* data, size_t len) override;
+        size_t receive(uint8_t* buf, size_t cap, Endpoint& from) override;
+        void forget(const Endpoint& e) override;
+        void format(const Endpoint& e, char* out, size_t cap) const override;
+
+        uint32_t dropped() const;                   // received while the queue was full
+
+    private:
+        bool addPeer(const uint8_t mac[6]);
+        bool begun_ = false;
+    };
+#endif
+
+    // In-process link: what one endpoint sends, its paired endpoint receives
+    class LoopbackLink : public Link {
+    public:
+        static constexpr size_t kMtu = 1024;
+        static constexpr uint8_t kSlots = 8;
+
+        explicit LoopbackLink(uint8_t id) { self_.addr[0] = id; }
+        static void pair(LoopbackLink& a, LoopbackLink& b);
+
+        const char* name() const override { return "loop"; }
+        size_t mtu() const override { return kMtu; }
+        bool begin() override { begun_ = true; return true; }
+        void end() override { begun_ = false; count_ = 0; }
+        bool ready() const override { return begun_; }
+        bool sendTo(const Endpoint& to, const uint8_t* data, size_t len) override;
+        bool broadcast(const uint8_t* data, size_t len) override;
+        size_t receive(uint8_t* buf, size_t cap, Endpoint& from) override;
+        void format(const Endpoint& e, char* out, size_t cap) const override;
+
+        const Endpoint& self() const { return self_; }
+        uint32_t dropped() const { return dropped_; }
+
+    private:
+        bool push(const Endpoint& from, const uint8_t* data, size_t len);
+
+        struct Slot {
+            Endpoint from;
+            size_t len;
+            uint8_t data[kMtu];
+        };
+        Slot slots_[kSlots];
+        uint8_t head_ = 0, count_ = 0;
+        Endpoint self_;
+        LoopbackLink* peer_ = nullptr;
+        bool begun_ = false;
+        uint32_t dropped_ = 0;
+    };
+}
@@ -0,0 +1,324 @@
+// hd44780_core.cpp
+//
+// Dispatch tables are generated at compile time from the US2066 instruction map; each
+// entry names an Op, and each Op has one handler. No Arduino headers on purpose.
+
+#include "hd44780_core.h"
+#include <string.h>
+
+namespace HD44780 {
+
+namespace {
+
+    // ---- Instruction map (one classifier per page) ----
+
+    constexpr Op classifyBase(uint8_t c) {
+        return c >= 0x80 ? Op::SetDdram
+             : c >= 0x40 ? Op::SetCgram
+             : c >= 0x20 ? Op::FunctionSet
+             : c >= 0x10 ? Op::Shift
+             : c >= 0x08 ? Op::DisplayCtrl
+             : c >= 0x04 ? Op::EntryMode
+             : c >= 0x02 ? Op::Home
+             : c == 0x01 ? Op::Clear
+             : Op::Nop;
+    }
+
+    constexpr Op classifyIs(uint8_t c) {
+        return (c >= 0x40 && c < 0x50) ? Op::SetSegram
+             : (c >= 0x10 && c < 0x20) ? Op::Nop
+             : classifyBase(c);
+    }
+
+    constexpr Op classifyExt(uint8_t c) {
+        return c == 0x71 ? Op::FunctionSelA
+             : c == 0x72 ? Op::FunctionSelB
+             : (c == 0x78 || c == 0x79) ? Op::OledCmdSet
+             : c >= 0xC0 ? Op::Nop
+             : c >= 0x80 ? Op::ScrollQuantity
+             : c >= 0x40 ? Op::Nop
+             : c >= 0x20 ? Op::FunctionSet
+             : c >= 0x10 ? Op::DoubleHeight
+             : c >= 0x08 ? Op::ExtFunctionSet
+             : c >= 0x04 ? Op::EntryModeExt
+             : c >= 0x02 ? Op::PowerDown
+             : c == 0x01 ? Op::Clear
+             : Op::Nop;
+    }
+
+    constexpr Op classifyOled(uint8_t c) {
+        return (c == 0x81 || c == 0xD5 || c == 0xD9 || c == 0xDA ||
+                c == 0xDB || c == 0xDC || c == 0x23) ? Op::OledArg
+             : classifyExt(c);
+    }
+
+    constexpr Op classifyPage(Page p, uint8_t c) {
+        return p == PAGE_BASE ? classifyBase(c)
+             : p == PAGE_IS   ? classifyIs(c)
+             : p == PAGE_EXT  ? classifyExt(c)
+             : classifyOled(c);
+    }
+
+    struct Table {
+        Op op[256];
+        constexpr explicit Table(Page p) : op() {
+            for (int i = 0; i < 256; ++i) op[i] = classifyPage(p, (uint8_t)i);
+        }
+    };
+
+    constexpr Table kTables[PAGE_COUNT] = {
+        Table(PAGE_BASE), Table(PAGE_IS), Table(PAGE_EXT), Table(PAGE_OLED)
+    };
+
+    static_assert(kTables[PAGE_BASE].op[0x01] == Op::Clear, "table");
+    static_assert(kTables[PAGE_BASE].op[0xC0] == Op::SetDdram, "table");
+    static_assert(kTables[PAGE_EXT].op[0x09] == Op::ExtFunctionSet, "table");
+    static_assert(kTables[PAGE_OLED].op[0x81] == Op::OledArg, "table");
+
+    // ---- Address counter / shift helpers ----
+
+    inline uint8_t mod(int v, uint8_t m) {
+        v %= m;
+        return (uint8_t)(v < 0 ? v + m : v);
+    }
+
+    void stepAddress(Core& c, int dir) {
+        if (c.ac_cgram) {
+            c.ac = (uint8_t)((c.ac + dir) & (kCgramSize - 1));
+        } else if (c.four_line) {
+            c.ac = (uint8_t)((c.ac + dir) & (kDdramSize - 1));
+        } else if (c.two_line) {
+            // Lines at 0x00-0x27 and 0x40-0x67; the counter hops between them
+            int a = c.ac + dir;
+            if (dir > 0) {
+                if (a == 0x28) a = 0x40;
+                else if (a >= 0x68) a = 0x00;
+            } else {
+                if (a < 0) a = 0x67;
+                else if (a == 0x3F) a = 0x27;
+            }
+            c.ac = (uint8_t)a;
+        } else {
+            c.ac = mod(c.ac + dir, 0x50);
+        }
+    }
+
+    void shiftDisplay(Core& c, bool left) {
+        c.shift = mod(c.shift + (left ? 1 : -1), lineLength(c));
+    }
+
+    void applyArgument(Core& c, uint8_t value) {
+        switch (c.pending) {
+            case 0x81: c.contrast = value;   break;
+            case 0x72: c.rom_select = value; break;
+            default: break;                  // clock/phase/VCOMH/SEG/fade: accepted, not modelled
+        }
+        c.pending = 0;
+    }
+
+    // ---- Handlers (one per Op) ----
+
+    void opNop(Core&, uint8_t) {}
+
+    void opClear(Core& c, uint8_t) {
+        memset(c.ddram, ' ', sizeof(c.ddram));
+        c.ac = 0;
+        c.ac_cgram = false;
+        c.shift = 0;
+        c.increment = true;
+    }
+
+    void opHome(Core& c, uint8_t) {
+        c.ac = 0;
+        c.ac_cgram = false;
+        c.shift = 0;
+    }
+
+    void opPowerDown(Core& c, uint8_t cmd) { c.power_down = (cmd & 0x01) != 0; }
+
+    void opEntryMode(Core& c, uint8_t cmd) {
+        c.increment = (cmd & 0x02) != 0;
+        c.entry_shift = (cmd & 0x01) != 0;
+    }
+
+    void opEntryModeExt(Core&, uint8_t) {}     // BDC/BDS: COM/SEG scan direction only
+
+    void opDisplayCtrl(Core& c, uint8_t cmd) {
+        c.display_on = (cmd & 0x04) != 0;
+        c.cursor_on  = (cmd & 0x02) != 0;
+        c.blink_on   = (cmd & 0x01) != 0;
+    }
+
+    void opExtFunctionSet(Core& c, uint8_t cmd) {
+        c.font_6dot     = (cmd & 0x04) != 0;
+        c.invert_cursor = (cmd & 0x02) != 0;
+        c.four_line     = (cmd & 0x01) != 0;
+        c.shift %= lineLength(c);
+    }
+
+    void opShift(Core& c, uint8_t cmd) {
+        const bool right = (cmd & 0x04) != 0;
+        if (cmd & 0x08) {
+            shiftDisplay(c, !right);
+        } else {
+            stepAddress(c, right ? 1 : -1);
+        }
+    }
+
+    void opDoubleHeight(Core& c, uint8_t cmd) {
+        if (!c.is) c.dh_mode = cmd & 0x0F;     // IS=1 variant is shift/scroll enable per line
+    }
+
+    void opFunctionSet(Core& c, uint8_t cmd) {
+        c.two_line = (cmd & 0x08) != 0;
+        c.re = (cmd & 0x02) != 0;
+        if (c.re) {
+            c.reverse = (cmd & 0x01) != 0;
+        } else {
+            c.double_height = (cmd & 0x04) != 0;
+            c.is = (cmd & 0x01) != 0;
+            c.sd = false;
+        }
+        c.shift %= lineLength(c);
+    }
+
+    void opSetCgram(Core& c, uint8_t cmd) {
+        c.ac = cmd & (kCgramSize - 1);
+        c.ac_cgram = true;
+    }
+
+    void opSetSegram(Core&, uint8_t) {}
+
+    void opSetDdram(Core& c, uint8_t cmd) {
+        c.ac = cmd & (kDdramSize - 1);
+        c.ac_cgram = false;
+    }
+
+    void opScrollQuantity(Core& c, uint8_t cmd) { c.scroll_quantity = cmd & 0x3F; }
+
+    void opPendingArg(Core& c, uint8_t cmd) { c.pending = cmd; }
+
+    void opOledCmdSet(Core& c, uint8_t cmd) { c.sd = (cmd & 0x01) != 0; }
+
+    using Handler = void (*)(Core&, uint8_t);
+
+    const Handler kHandlers[(size_t)Op::Count] = {
+        opNop,              // Nop
+        opClear,            // Clear
+        opHome,             // Home
+        opPowerDown,        // PowerDown
+        opEntryMode,        // EntryMode
+        opEntryModeExt,     // EntryModeExt
+        opDisplayCtrl,      // DisplayCtrl
+        opExtFunctionSet,   // ExtFunctionSet
+        opShift,            // Shift
+        opDoubleHeight,     // DoubleHeight
+        opFunctionSet,      // FunctionSet
+        opSetCgram,         // SetCgram
+        opSetSegram,        // SetSegram
+        opSetDdram,         // SetDdram
+        opScrollQuantity,   // ScrollQuantity
+        opPendingArg,       // FunctionSelA
+        opPendingArg,       // FunctionSelB
+        opOledCmdSet,       // OledCmdSet
+        opPendingArg,       // OledArg
+    };
+
+} // namespace
+
+void reset(Core& c) {
+    c = Core();
+    memset(c.ddram, ' ', sizeof(c.ddram));
+    memset(c.cgram, 0, sizeof(c.cgram));
+}
+
+Op classify(Page p, uint8_t cmd) {
+    return kTables[p].op[cmd];
+}
+
+Op command(Core& c, uint8_t cmd) {
+    c.commands++;
+    if (c.pending) {
+        // SD=1 double-byte commands carry their argument as a command byte
+        const Op op = kTables[page(c)].op[c.pending];
+        applyArgument(c, cmd);
+        return op;
+    }
+    const Op op = kTables[page(c)].op[cmd];
+    kHandlers[(size_t)op](c, cmd);
+    return op;
+}
+
+bool data(Core& c, uint8_t value) {
+    c.data_writes++;
+    if (c.pending) {
+        // Function selection A/B (and some hosts' contrast) carry their argument as data
+        applyArgument(c, value);
+        return false;
+    }
+    if (c.ac_cgram) {
+        c.cgram[c.ac & (kCgramSize - 1)] = value;
+        stepAddress(c, c.increment ? 1 : -1);
+        return false;
+    }
+    c.ddram[c.ac & (kDdramSize - 1)] = value;
+    stepAddress(c, c.increment ? 1 : -1);
+    if (c.entry_shift) shiftDisplay(c, c.increment);
+    return true;
+}
+
+uint8_t lineLength(const Core& c) {
+    return c.four_line ? 0x20 : (c.two_line ? 0x28 : 0x50);
+}
+
+uint8_t ddramIndex(const Core& c, uint8_t row, uint8_t col) {
+    const uint8_t len = lineLength(c);
+    uint8_t base, seg;
+    if (c.four_line) {
+        base = (uint8_t)(row * 0x20);
+        seg = 0;
+    } else if (c.two_line) {
+        base = (row & 1) ? 0x40 : 0x00;
+        seg = (uint8_t)((row >> 1) * kCols);
+    } else {
+        base = 0;
+        seg = (uint8_t)(row * kCols);
+    }
+    return (uint8_t)(base + (seg + col + c.shift) % len);
+}
+
+bool cursorPosition(const Core& c, uint8_t& row, uint8_t& col) {
+    if (c.ac_cgram) return false;
+    const uint8_t len = lineLength(c);
+    uint8_t rel;
+    if (c.four_line) {
+        rel = mod((c.ac & 0x1F) - c.shift, len);
+        if (rel >= kCols) return false;
+        row = c.ac >> 5;
+        col = rel;
+    } else if (c.two_line) {
+        const uint8_t line = c.ac >= 0x40 ? 1 : 0;
+        const uint8_t pos = (uint8_t)(c.ac - line * 0x40);
+        if (pos >= len) return false;
+        rel = mod(pos - c.shift, len);
+        row = (uint8_t)(line + (rel >= kCols ? 2 : 0));
+        col = rel % kCols;
+    } else {
+        if (c.ac >= len) return false;
+        rel = mod(c.ac - c.shift, len);
+        row = rel / kCols;
+        col = rel % kCols;
+    }
+    return true;
+}
+
+void loadRow(Core& c, uint8_t row, const char* text, uint8_t len) {
+    if (row >= kRows) return;
+    bool ended = false;
+    for (uint8_t col = 0; col < kCols; ++col) {
+        if (col >= len || !text[col]) ended = true;
+        c.ddram[ddramIndex(c, row, col)] = ended ? ' ' : (uint8_t)text[col];
+    }
+}
+
+} // namespace HD44780
@@ -0,0 +1,127 @@
+// hd44780_core.h
+//
+// Table-driven HD44780/US2066 instruction decoder.
+// Models the complete US2066 command set (fundamental RE=0/IS=0, IS=1, extended RE=1 and
+// the SD=1 OLED characterization set), a full 128-byte DDRAM, CGRAM and the display-shift
+// offset. Every command byte is resolved through a constexpr 256-entry table per
+// instruction page, so decoding is one table load plus one indirect call.
+//
+// This file and hd44780_core.cpp have no Arduino dependencies; they build on a Linux host
+// (g++ -std=c++17 -O2 -c hd44780_core.cpp) for benchmarking decode throughput.
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+namespace HD44780 {
+
+    static constexpr uint8_t kRows        = 4;     // visible rows
+    static constexpr uint8_t kCols        = 20;    // visible columns
+    static constexpr uint8_t kDdramSize   = 128;
+    static constexpr uint8_t kCgramSize   = 64;    // 8 glyphs x 8 lines
+
+    // Decoded operation for one command byte. Table entries are one of these.
+    enum class Op : uint8_t {
+        Nop = 0,
+        Clear,              // 0x01
+        Home,               // 0x02-0x03            (RE=0)
+        PowerDown,          // 0x02-0x03            (RE=1)
+        EntryMode,          // 0x04-0x07 I/D, S     (RE=0)
+        EntryModeExt,       // 0x04-0x07 BDC, BDS   (RE=1)
+        DisplayCtrl,        // 0x08-0x0F D, C, B    (RE=0)
+        ExtFunctionSet,     // 0x08-0x0F FW, B/W, NW (RE=1)
+        Shift,              // 0x10-0x1F S/C, R/L   (RE=0, IS=0)
+        DoubleHeight,       // 0x10-0x1F UD2, UD1, BS1, DH' (RE=1, IS=0) / shift enable (RE=1, IS=1)
+        FunctionSet,        // 0x20-0x3F N, DH|BE, RE, IS|REV
+        SetCgram,           // 0x40-0x7F            (RE=0, IS=0)
+        SetSegram,          // 0x40-0x4F            (RE=0, IS=1)
+        SetDdram,           // 0x80-0xFF            (RE=0)
+        ScrollQuantity,     // 0x80-0xBF            (RE=1)
+        FunctionSelA,       // 0x71 + data byte     (RE=1)
+        FunctionSelB,       // 0x72 + data byte     (RE=1)
+        OledCmdSet,         // 0x78/0x79 SD=0/1     (RE=1 or SD=1)
+        OledArg,            // SD=1 double-byte commands: 0x81, 0xD5, 0xD9, 0xDA, 0xDB, 0xDC, 0x23
+        Count
+    };
+
+    // Instruction pages; the active page selects the dispatch table.
+    enum Page : uint8_t {
+        PAGE_BASE = 0,      // RE=0, IS=0
+        PAGE_IS   = 1,      // RE=0, IS=1
+        PAGE_EXT  = 2,      // RE=1
+        PAGE_OLED = 3,      // RE=1, SD=1
+        PAGE_COUNT
+    };
+
+    struct Core {
+        uint8_t ddram[kDdramSize];
+        uint8_t cgram[kCgramSize];
+
+        uint8_t ac = 0;                 // address counter (DDRAM or CGRAM)
+        bool    ac_cgram = false;       // true after Set CGRAM until the next Set DDRAM
+        uint8_t shift = 0;              // display shift offset, 0..lineLength()-1
+
+        // Entry mode
+        bool increment = true;          // I/D
+        bool entry_shift = false;       // S: shift display on each data write
+
+        // Display control
+        bool display_on = false;
+        bool cursor_on = false;
+        bool blink_on = false;
+
+        // Function set / extended function set
+        bool two_line = true;           // N
+        bool four_line = true;          // NW (US2066 4-line mode; 0x00/0x20/0x40/0x60 rows)
+        bool double_height = false;     // DH
+        bool re = false;                // extended instruction set
+        bool is = false;                // special instruction set
+        bool sd = false;                // OLED characterization set
+        bool font_6dot = false;         // FW
+        bool invert_cursor = false;     // B/W
+        bool reverse = false;           // REV
+        bool power_down = false;
+        uint8_t dh_mode = 0;            // UD2/UD1/DH' bits from the double-height command
+        uint8_t scroll_quantity = 0;
+
+        // Double-byte commands: opcode awaiting its argument (0 = none)
+        uint8_t pending = 0;
+        uint8_t contrast = 0x7F;
+        uint8_t rom_select = 0;         // Function selection B
+
+        uint32_t commands = 0;
+        uint32_t data_writes = 0;
+    };
+
+    // Power-on defaults (blank DDRAM, 4-line mode, display off)
+    void reset(Core& c);
+
+    // Execute one instruction byte. Returns the operation it decoded to.
+    Op command(Core& c, uint8_t cmd);
+
+    // Write one data byte to DDRAM/CGRAM (or consume it as a pending argument).
+    // Returns true if visible DDRAM content may have changed.
+    bool data(Core& c, uint8_t value);
+
+    // Page that command(c, ...) will dispatch through next
+    inline Page page(const Core& c) {
+        return c.sd ? PAGE_OLED : (c.re ? PAGE_EXT : (c.is ? PAGE_IS : PAGE_BASE));
+    }
+
+    // Table lookup without side effects (for tracing)
+    Op classify(Page p, uint8_t cmd);
+
+    // Length of one display line in DDRAM for the current mode (32 in 4-line, 40 in 2-line)
+    uint8_t lineLength(const Core& c);
+
+    // DDRAM address shown at visible (row, col) with the current display shift
+    uint8_t ddramIndex(const Core& c, uint8_t row, uint8_t col);
+
+    // Visible cursor position derived from the address counter. Returns false if the
+    // address counter points outside the visible window (or at CGRAM).
+    bool cursorPosition(const Core& c, uint8_t& row, uint8_t& col);
+
+    // Write text into the visible cells of one row (used for the boot splash)
+    void loadRow(Core& c, uint8_t row, const char* text, uint8_t len);
+}
@@ -0,0 +1,150 @@
+// lcd_json.cpp
+
+#include "lcd_json.h"
+#include <stdio.h>
+#include <string.h>
+
+namespace LCDJson {
+
+namespace {
+
+    inline char printable(char c) { return (c < 0x20 || c > 0x7E) ? ' ' : c; }
+
+    // Bounded appender; 'ok' drops to false once anything did not fit
+    struct Writer {
+        char* out;
+        size_t cap;
+        size_t len = 0;
+        bool ok = true;
+
+        Writer(char* o, size_t c) : out(o), cap(c) {}
+
+        void ch(char c) {
+            if (len + 1 < cap) out[len++] = c;
+            else ok = false;
+        }
+        void str(const char* s) {
+            while (*s) ch(*s++);
+        }
+        void num(uint32_t v) {
+            char buf[11];
+            snprintf(buf, sizeof(buf), "%lu", (unsigned long)v);
+            str(buf);
+        }
+        void boolean(bool b) { str(b ? "true" : "false"); }
+        // One display cell inside a JSON string
+        void cell(char c) {
+            c = printable(c);
+            if (c == '"' || c == '\\') ch('\\');
+            ch(c);
+        }
+        // "key":"value" with the value escaped
+        void text(const char* key, const char* v) {
+            str(key);
+            ch('"');
+            for (; *v; ++v) {
+                if (*v == '"' || *v == '\\') ch('\\');
+                ch(*v);
+            }
+            ch('"');
+        }
+    };
+
+} // namespace
+
+size_t write(char* out, size_t cap, const Meta& m, const LCDFrame::Frame& f) {
+    if (!out || cap == 0) return 0;
+    Writer w(out, cap);
+    w.str("{\"type\":\"lcd20x4\"");
+    if (m.src) {
+        w.text(",\"src\":", m.src);
+        w.str(",\"hop\":");
+        w.num(m.hop);
+    }
+    w.text(",\"mode\":", m.mode);
+    w.text(",\"addr\":", m.addr);
+    if (m.has_gen) {
+        w.str(",\"gen\":");
+        w.num(m.gen);
+    }
+    if (m.fmt) w.str(",\"fmt\":[\"json\",\"bin1\"]");
+    w.str(",\"disp\":");
+    w.boolean(f.display_on);
+    w.str(",\"cur\":");
+    w.boolean(f.cursor_on);
+    w.str(",\"blink\":");
+    w.boolean(f.blink_on);
+    w.str(",\"cursor\":{\"r\":");
+    w.num(f.cursor_row);
+    w.str(",\"c\":");
+    w.num(f.cursor_col);
+    w.str("},\"rows\":[");
+    for (uint8_t r = 0; r < LCDFrame::kRows; ++r) {
+        if (r) w.ch(',');
+        w.ch('"');
+        for (uint8_t c = 0; c < LCDFrame::kCols; ++c) w.cell(f.rows[r][c]);
+        w.ch('"');
+    }
+    w.str("]}");
+    out[w.len] = '\0';
+    return w.ok ? w.len : 0;
+}
+
+size_t writeDelta(char* out, size_t cap, uint32_t gen, uint32_t base_gen,
+                  const LCDFrame::Frame& base, const LCDFrame::Frame& f) {
+    if (!out || cap == 0) return 0;
+    Writer w(out, cap);
+    w.str("{\"gen\":");
+    w.num(gen);
+    w.str(",\"base\":");
+    w.num(base_gen);
+    w.str(",\"disp\":");
+    w.boolean(f.display_on);
+    w.str(",\"cur\":");
+    w.boolean(f.cursor_on);
+    w.str(",\"blink\":");
+    w.boolean(f.blink_on);
+    w.str(",\"cursor\":{\"r\":");
+    w.num(f.cursor_row);
+    w.str(",\"c\":");
+    w.num(f.cursor_col);
+    w.str("},\"cells\":[");
+    bool first = true;
+    for (uint8_t r = 0; r < LCDFrame::kRows; ++r) {
+        uint8_t c = 0;
+        while (c < LCDFrame::kCols) {
+            if (printable(base.rows[r][c]) == printable(f.rows[r][c])) {
+                c++;
+                continue;
+            }
+            // Run of changed cells; gaps shorter than a new run's overhead are folded in
+            uint8_t end = c + 1, last = c;
+            while (end < LCDFrame::kCols && end - last <= kDeltaGap) {
+                if (printable(base.rows[r][end]) != printable(f.rows[r][end])) last = end;
+                end++;
+            }
+            if (!first) w.ch(',');
+            first = false;
+            w.ch('[');
+            w.num(r);
+            w.ch(',');
+            w.num(c);
+            w.str(",\"");
+            for (uint8_t k = c; k <= last; ++k) w.cell(f.rows[r][k]);
+            w.str("\"]");
+            c = last + 1;
+        }
+    }
+    w.str("]}");
+    out[w.len] = '\0';
+    return w.ok ? w.len : 0;
+}
+
+size_t markRepeat(char* json, size_t len, size_t cap) {
+    static const char kRep[] = ",\"rep\":true}";
+    if (len < 2 || json[len - 1] != '}' || len - 1 + sizeof(kRep) > cap) return 0;
+    memcpy(json + len - 1, kRep, sizeof(kRep));     // includes the NUL
+    return len - 1 + sizeof(kRep) - 1;
+}
+
+} // namespace LCDJson
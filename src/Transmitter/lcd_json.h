@@ -0,0 +1,49 @@
+// lcd_json.h
+//
+// The "lcd20x4" JSON frame, written straight into a caller's buffer: no ArduinoJson
+// document, no String, no heap. Every producer uses it (Transmitter UDP, SSE and
+// /emu/state through FrameCache; Receiver telemetry), so the schema cannot drift.
+// Kept identical in both sketch folders, like lcd_frame.h.
+//
+// Field order: type, src, hop, mode, addr, gen, fmt, disp, cur, blink, cursor, rows.
+// The source tag comes first so a truncated read still carries it. Row bytes outside
+// printable ASCII become spaces; '"' and '\' are escaped.
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "lcd_frame.h"
+
+namespace LCDJson {
+
+    // Largest frame write() can produce (every row fully escaped, all fields)
+    static constexpr size_t kMaxSize = 448;
+
+    struct Meta {
+        const char* src = nullptr;      // "src" + "hop"; both omitted if null
+        uint8_t hop = 0;                // 0 = read off the I2C bus, 1 = a panel's mirror
+        const char* mode = "US2066";
+        const char* addr = "0x3C";
+        bool has_gen = true;            // write "gen"
+        uint32_t gen = 0;
+        bool fmt = true;                // write "fmt":["json","bin1"] (sender advertisement)
+    };
+
+    // Returns the length written (out is NUL-terminated), 0 if 'cap' is too small.
+    size_t write(char* out, size_t cap, const Meta& m, const LCDFrame::Frame& f);
+
+    // Cell-level change from 'base' (generation base_gen) to 'f' (generation gen), for
+    // consumers that hold 'base':
+    //   {"gen":43,"base":42,"disp":..,"cur":..,"blink":..,"cursor":{..},"cells":[[row,col,"text"],..]}
+    // Each cells entry overwrites row 'row' from column 'col'. Changed runs closer than
+    // kDeltaGap unchanged cells are sent as one. Returns the length, 0 if 'cap' is too small.
+    static constexpr uint8_t kDeltaGap = 8;
+    size_t writeDelta(char* out, size_t cap, uint32_t gen, uint32_t base_gen,
+                      const LCDFrame::Frame& base, const LCDFrame::Frame& f);
+
+    // Turn a written frame into its FEC repeat in place (appends "rep":true).
+    // Returns the new length, 0 if it does not fit.
+    size_t markRepeat(char* json, size_t len, size_t cap);
+}
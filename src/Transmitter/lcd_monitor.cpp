@@ -2,19 +2,22 @@
 //
 // HD44780 LCD Slave Device for Original Xbox Type-D firmware
 // ESP32 presents itself as US2066/SH1122 OLED controller at address 0x3C
-// Handles PrometheOS I2C protocol: [CONTROL_BYTE] [DATA_BYTE]
+// Handles the US2066 I2C protocol: Co=1 [CONTROL_BYTE] [BYTE] pairs and Co=0 bulk streams
 
 #include "lcd_monitor.h"
+#include "hd44780_core.h"
+#include "dlog.h"
+#include "net_egress.h"
 #include <Arduino.h>
-#include <WiFiUdp.h>
-#include <ArduinoJson.h>
 #include <Wire.h>
+#include <atomic>
 
 // Private state
-static WiFiUDP lcdUdp;
-static bool udp_begun = false;
 static LCDMonitor::LCDState lcd_state;
 
+// Decoder task (core LCD_DECODE_CORE): woken by the Wire1 callback, drains the capture ring
+static TaskHandle_t decode_task = nullptr;
+
 // I2C slave configuration
 static const uint8_t LCD_I2C_ADDRESS = 0x3C;
 static bool i2c_slave_active = false;
@@ -24,34 +27,61 @@ static volatile bool emulator_enabled = true;   // toggled by WiFiMgr via setEmu
 static int g_sda_pin = -1;
 static int g_scl_pin = -1;
 
-// HD44780 state
-static uint8_t ddram_address = 0x00;
+// HD44780/US2066 controller model (DDRAM, address counter, shift, modes)
+static HD44780::Core lcd_core;
+
+// US2066 I2C control-byte grammar: Co (bit 7) = 1 -> one payload byte then another control
+// byte; Co = 0 -> every remaining byte of the write is payload. D/C# (bit 6) selects data.
+#define US2066_CTRL_CO   0x80
+#define US2066_CTRL_DC   0x40
+
+enum class FrameParse : uint8_t { Control, Single, Stream };
+static FrameParse frame_parse = FrameParse::Control;
+static bool frame_is_data = false;
+static uint8_t frame_control = 0;
+static LCDMonitor::FramingStats framing;
+
+// ---- Published snapshot (seqlock) ----
+// lcd_state is private to the decoder task. Every content change is copied into
+// 'published' under a sequence counter: odd while the copy is in progress, even when
+// stable. Readers copy and retry if the counter moved; the writer never waits on them.
+// The writer section runs inside a critical section so a same-core reader can never
+// preempt it half way through and then spin on it.
+static LCDMonitor::DisplayFrame published;
+static std::atomic<uint32_t> published_seq{0};
+static std::atomic<uint32_t> published_gen{0};
+static std::atomic<uint32_t> last_write_ms{0};    // capture time of the latest decoded write
+static portMUX_TYPE published_mux = portMUX_INITIALIZER_UNLOCKED;
+static std::atomic<uint32_t> snapshot_reads{0};
+static std::atomic<uint32_t> snapshot_retries{0};
+static std::atomic<uint32_t> snapshot_max_retries{0};
 
-// HD44780 Commands
-#define HD44780_CLEAR_DISPLAY     0x01
-#define HD44780_RETURN_HOME       0x02
-#define HD44780_ENTRY_MODE_SET    0x04
-#define HD44780_DISPLAY_CONTROL   0x08
-#define HD44780_CURSOR_SHIFT      0x10
-#define HD44780_FUNCTION_SET      0x20
-#define HD44780_SET_CGRAM_ADDR    0x40
-#define HD44780_SET_DDRAM_ADDR    0x80
+// ---- I2C capture ring (single producer: Wire1 slave callback, single consumer: decoder task) ----
+static_assert((LCD_CAPTURE_RING_SIZE & (LCD_CAPTURE_RING_SIZE - 1)) == 0,
+              "LCD_CAPTURE_RING_SIZE must be a power of two");
+static LCDMonitor::I2CTransaction capture_ring[LCD_CAPTURE_RING_SIZE];
+static std::atomic<uint16_t> capture_head{0};   // written by producer only
+static std::atomic<uint16_t> capture_tail{0};   // written by consumer only
+static std::atomic<uint32_t> capture_captured{0};
+static std::atomic<uint32_t> capture_dropped{0};
+static std::atomic<uint16_t> capture_high_water{0};
+static uint32_t capture_decoded = 0;
+// Status-read view of the decoder (slave task reads, decoder task writes): ring position up
+// to which records are fully decoded, and the address counter after the last of them
+static std::atomic<uint16_t> capture_done{0};
+static std::atomic<uint8_t> status_ac{0};
+static uint32_t capture_dropped_reported = 0;
 
 namespace LCDMonitor {
 
     // Forward declarations
     static void processHD44780Command(uint8_t cmd);
     static void processHD44780Data(uint8_t data);
-    static void updateCursorPosition();
+    static void syncStateFromCore();
+    static void publishSnapshot();
+    static void decodeTask(void*);
     static char translateHD44780Character(uint8_t code);
 
-    static void ensureUdp() {
-        if (!udp_begun) {
-            lcdUdp.begin(LCD_MONITOR_UDP_PORT);
-            udp_begun = true;
-        }
-    }
-
     // Simple ASCII character translation
     static char translateHD44780Character(uint8_t code) {
         // Only allow standard printable ASCII characters
@@ -62,131 +92,165 @@ namespace LCDMonitor {
         return ' ';
     }
 
-    // Update cursor position from DDRAM address
-    static void updateCursorPosition() {
-        // PrometheOS uses these row offsets: { 0x00, 0x20, 0x40, 0x60 }
-        if (ddram_address < 0x20) {
-            lcd_state.cursor_row = 0;
-            lcd_state.cursor_col = ddram_address;
-        } else if (ddram_address >= 0x20 && ddram_address < 0x40) {
-            lcd_state.cursor_row = 1;
-            lcd_state.cursor_col = ddram_address - 0x20;
-        } else if (ddram_address >= 0x40 && ddram_address < 0x60) {
-            lcd_state.cursor_row = 2;
-            lcd_state.cursor_col = ddram_address - 0x40;
-        } else if (ddram_address >= 0x60 && ddram_address < 0x80) {
-            lcd_state.cursor_row = 3;
-            lcd_state.cursor_col = ddram_address - 0x60;
-        } else {
-            // Fallback
-            lcd_state.cursor_row = 0;
-            lcd_state.cursor_col = 0;
+    // Refresh the visible 4x20 frame, cursor and display flags from the controller model.
+    // Only cells/fields whose value differs are written; any difference bumps the content
+    // generation. Rewrites of identical data change nothing.
+    static void syncStateFromCore() {
+        bool changed = false;
+
+        for (uint8_t row = 0; row < HD44780::kRows; row++) {
+            for (uint8_t col = 0; col < HD44780::kCols; col++) {
+                const char ch =
+                    translateHD44780Character(lcd_core.ddram[HD44780::ddramIndex(lcd_core, row, col)]);
+                if (lcd_state.rows[row][col] != ch) {
+                    lcd_state.rows[row][col] = ch;
+                    changed = true;
+                }
+            }
+            lcd_state.rows[row][20] = '\0';
         }
-        
-        // Clamp to valid display area
-        if (lcd_state.cursor_row >= 4) lcd_state.cursor_row = 3;
-        if (lcd_state.cursor_col >= 20) lcd_state.cursor_col = 19;
+
+        uint8_t row = 0, col = 0;
+        if (!HD44780::cursorPosition(lcd_core, row, col)) {
+            // Address counter is off-screen: clamp to valid display area
+            row = (lcd_core.ac >> 5) & 0x03;
+            col = 19;
+        }
+
+        if (lcd_state.cursor_row != row || lcd_state.cursor_col != col ||
+            lcd_state.display_on != lcd_core.display_on ||
+            lcd_state.cursor_on != lcd_core.cursor_on ||
+            lcd_state.blink_on != lcd_core.blink_on) {
+            lcd_state.cursor_row = row;
+            lcd_state.cursor_col = col;
+            lcd_state.display_on = lcd_core.display_on;
+            lcd_state.cursor_on = lcd_core.cursor_on;
+            lcd_state.blink_on = lcd_core.blink_on;
+            changed = true;
+        }
+
+        if (changed) {
+            lcd_state.generation++;
+            publishSnapshot();
+        }
+    }
+
+    // Copy the visible frame out to readers (decoder task only)
+    static void publishSnapshot() {
+        portENTER_CRITICAL(&published_mux);
+        const uint32_t seq = published_seq.load(std::memory_order_relaxed);
+        published_seq.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        memcpy(published.rows, lcd_state.rows, sizeof(published.rows));
+        published.cursor_row = lcd_state.cursor_row;
+        published.cursor_col = lcd_state.cursor_col;
+        published.display_on = lcd_state.display_on;
+        published.cursor_on = lcd_state.cursor_on;
+        published.blink_on = lcd_state.blink_on;
+        published.generation = lcd_state.generation;
+
+        published_seq.store(seq + 2, std::memory_order_release);
+        portEXIT_CRITICAL(&published_mux);
+        published_gen.store(lcd_state.generation, std::memory_order_release);
+
+        // Hand the new generation to the network egress task on the other core
+        NetEgress::notifyFrame();
+    }
+
+    // Push one record into the capture ring. Producer side only; never blocks.
+    static bool capturePush(const uint8_t* data, uint8_t len, uint32_t ts, bool continued) {
+        const uint16_t head = capture_head.load(std::memory_order_relaxed);
+        const uint16_t tail = capture_tail.load(std::memory_order_acquire);
+        const uint16_t used = (uint16_t)(head - tail);
+        if (used >= LCD_CAPTURE_RING_SIZE) {
+            capture_dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        I2CTransaction& tx = capture_ring[head & (LCD_CAPTURE_RING_SIZE - 1)];
+        tx.address = LCD_I2C_ADDRESS;
+        memcpy(tx.data, data, len);
+        tx.length = len;
+        tx.timestamp_ms = ts;
+        tx.is_write = true;
+        tx.continued = continued;
+        capture_head.store((uint16_t)(head + 1), std::memory_order_release);
+
+        capture_captured.fetch_add(1, std::memory_order_relaxed);
+        if (used + 1 > capture_high_water.load(std::memory_order_relaxed)) {
+            capture_high_water.store((uint16_t)(used + 1), std::memory_order_relaxed);
+        }
+        return true;
+    }
+
+    // Pop one record from the capture ring. Consumer side only.
+    static bool capturePop(I2CTransaction& out) {
+        const uint16_t tail = capture_tail.load(std::memory_order_relaxed);
+        if (tail == capture_head.load(std::memory_order_acquire)) return false;
+        out = capture_ring[tail & (LCD_CAPTURE_RING_SIZE - 1)];
+        capture_tail.store((uint16_t)(tail + 1), std::memory_order_release);
+        return true;
     }
 
-    // US2066/OLED I2C handler - PrometheOS protocol
+    // US2066/OLED I2C handler - capture only.
+    // arduino-esp32 calls this from its I2C slave task, not from an ISR (hence plain
+    // Wire1/millis/xTaskNotifyGive and no IRAM placement). Copies the raw bytes into the
+    // ring, wakes the decoder task and returns, so the slave task is back for the next
+    // transaction quickly.
+    // Writes longer than one record (bulk Co=0 streams) are split and the follow-on
+    // records marked 'continued' so the decoder keeps its framing state. Once a record
+    // of a write is dropped the rest of that write is dropped too.
     static void onI2CReceive(int numBytes) {
-        Serial.printf("[LCD] RX: %d bytes\n", numBytes);
-        
-        // US2066 protocol: pairs of [control_byte, data_byte]
-        while (Wire1.available() >= 2) {
-            uint8_t control_byte = Wire1.read();
-            uint8_t data_byte = Wire1.read();
-            
-            Serial.printf("[LCD] Control: 0x%02X, Data: 0x%02X\n", control_byte, data_byte);
-            
-            if (control_byte == 0x80) {
-                // Command mode
-                Serial.printf("[LCD] -> Command: 0x%02X\n", data_byte);
-                processHD44780Command(data_byte);
-            } else if (control_byte == 0x40) {
-                // Data mode (character)
-                Serial.printf("[LCD] -> Character: 0x%02X '%c'\n", data_byte, 
-                             (data_byte >= 0x20 && data_byte <= 0x7E) ? (char)data_byte : '?');
-                processHD44780Data(data_byte);
-            } else {
-                Serial.printf("[LCD] -> Unknown control: 0x%02X\n", control_byte);
+        const uint32_t ts = millis();
+        uint8_t buf[sizeof(I2CTransaction::data)];
+        uint8_t n = 0;
+        bool continued = false;
+        bool ok = true;
+
+        while (Wire1.available() > 0) {
+            buf[n++] = (uint8_t)Wire1.read();
+            if (n == sizeof(buf)) {
+                ok = ok && capturePush(buf, n, ts, continued);
+                continued = true;
+                n = 0;
             }
         }
-        
-        // Handle any remaining single byte (shouldn't happen in normal operation)
-        if (Wire1.available() > 0) {
-            uint8_t lone_byte = Wire1.read();
-            Serial.printf("[LCD] WARNING: Lone byte: 0x%02X\n", lone_byte);
-        }
-        
-        lcd_state.last_update_ms = millis();
+        if (n > 0 && ok) capturePush(buf, n, ts, continued);
+        if (decode_task) xTaskNotifyGive(decode_task);
     }
 
-    // I2C slave request handler
+    // I2C slave request handler (slave task). lcd_core belongs to the decoder, so answer
+    // from what it published: busy (bit 7) while captured writes are still undecoded, so a
+    // host that writes and then polls the busy flag never sees an AC from before its write.
     static void onI2CRequest() {
-        uint8_t status = 0x00 | (ddram_address & 0x7F);
+        const bool busy = capture_head.load(std::memory_order_acquire) !=
+                          capture_done.load(std::memory_order_acquire);
+        uint8_t status = (busy ? 0x80 : 0x00) | status_ac.load(std::memory_order_relaxed);
         Wire1.write(status);
-        Serial.printf("[LCD] Status: 0x%02X\n", status);
+        DLOG_T(LcdStatusRead, status);
     }
 
-    // Process HD44780 command
+    // Process HD44780 command through the US2066 dispatch tables
     static void processHD44780Command(uint8_t cmd) {
-        Serial.printf("[LCD] CMD: 0x%02X ", cmd);
-        
-        if (cmd == HD44780_CLEAR_DISPLAY) {
-            for (int row = 0; row < 4; row++) {
-                memset(lcd_state.rows[row], ' ', 20);
-                lcd_state.rows[row][20] = '\0';
-            }
-            lcd_state.cursor_row = 0;
-            lcd_state.cursor_col = 0;
-            ddram_address = 0x00;
-            Serial.println("(Clear)");
-        }
-        else if (cmd == HD44780_RETURN_HOME) {
-            lcd_state.cursor_row = 0;
-            lcd_state.cursor_col = 0;
-            ddram_address = 0x00;
-            Serial.println("(Home)");
-        }
-        else if ((cmd & 0x80) == HD44780_SET_DDRAM_ADDR) {
-            ddram_address = cmd & 0x7F;
-            updateCursorPosition();
-            Serial.printf("(DDRAM: 0x%02X -> %d,%d)\n", ddram_address, 
-                         lcd_state.cursor_row, lcd_state.cursor_col);
-        }
-        else if ((cmd & 0xF8) == HD44780_DISPLAY_CONTROL) {
-            lcd_state.display_on = (cmd & 0x04) != 0;
-            lcd_state.cursor_on = (cmd & 0x02) != 0;
-            lcd_state.blink_on = (cmd & 0x01) != 0;
-            Serial.printf("(Display: %s)\n", lcd_state.display_on ? "ON" : "OFF");
-        }
-        else {
-            Serial.printf("(Other: 0x%02X)\n", cmd);
+        const HD44780::Page page = HD44780::page(lcd_core);
+        const HD44780::Op op = HD44780::command(lcd_core, cmd);
+
+        switch (op) {
+            case HD44780::Op::Clear:       DLOG_D(LcdCmdClear, cmd); break;
+            case HD44780::Op::Home:        DLOG_D(LcdCmdHome, cmd); break;
+            case HD44780::Op::SetDdram:    DLOG_D(LcdCmdDdram, lcd_core.ac); break;
+            case HD44780::Op::DisplayCtrl: DLOG_D(LcdCmdDisplay, cmd, lcd_core.display_on); break;
+            case HD44780::Op::Shift:       DLOG_D(LcdCmdShift, cmd, lcd_core.shift, lcd_core.ac); break;
+            default:                       DLOG_D(LcdCmdOther, cmd, (uint32_t)op, page); break;
         }
     }
 
     // Process HD44780 character data
     static void processHD44780Data(uint8_t data) {
-        if (lcd_state.cursor_row < 4 && lcd_state.cursor_col < 20) {
-            char ch = translateHD44780Character(data);
-            lcd_state.rows[lcd_state.cursor_row][lcd_state.cursor_col] = ch;
-            
-            Serial.printf("[LCD] '%c' at (%d,%d)\n", ch, lcd_state.cursor_row, lcd_state.cursor_col);
-            
-            // Auto-increment cursor
-            lcd_state.cursor_col++;
-            if (lcd_state.cursor_col >= 20) {
-                lcd_state.cursor_col = 0;
-                lcd_state.cursor_row++;
-                if (lcd_state.cursor_row >= 4) {
-                    lcd_state.cursor_row = 0;
-                }
-            }
-            
-            // Update DDRAM address to match cursor position
-            int row_offsets[] = { 0x00, 0x20, 0x40, 0x60 };
-            ddram_address = row_offsets[lcd_state.cursor_row] + lcd_state.cursor_col;
+        const uint8_t addr = lcd_core.ac;
+        if (HD44780::data(lcd_core, data)) {
+            DLOG_T(LcdChar, data, addr);
         }
     }
 
@@ -195,26 +259,28 @@ namespace LCDMonitor {
         g_sda_pin = sda_pin;
         g_scl_pin = scl_pin;
 
-        // Initialize display state
+        // Initialize display state (generation restarts at 1 for the splash frame)
         lcd_state = LCDState();
-        for (int row = 0; row < 4; row++) {
-            memset(lcd_state.rows[row], ' ', 20);
-            lcd_state.rows[row][20] = '\0';
-        }
-        
+        for (int row = 0; row < 4; row++) memset(lcd_state.rows[row], ' ', 20);
+        HD44780::reset(lcd_core);
+        lcd_core.display_on = true;
+
         // Set initial display content
-        strncpy(lcd_state.rows[0], "Type D OLED Emulator", 20);
-        strncpy(lcd_state.rows[1], "   Code:Darkone83   ", 20);
-        strncpy(lcd_state.rows[2], "   Team Resurgent   ", 20);
-        strncpy(lcd_state.rows[3], "      (c) 2025      ", 20);
-        
+        HD44780::loadRow(lcd_core, 0, "Type D OLED Emulator", 20);
+        HD44780::loadRow(lcd_core, 1, "   Code:Darkone83   ", 20);
+        HD44780::loadRow(lcd_core, 2, "   Team Resurgent   ", 20);
+        HD44780::loadRow(lcd_core, 3, "      (c) 2025      ", 20);
+        syncStateFromCore();
+        status_ac.store(lcd_core.ac & 0x7F, std::memory_order_relaxed);
+
+        // Decoder runs on its own core so WiFi/HTTP work on core 0 never delays it
+        if (!decode_task) {
+            xTaskCreatePinnedToCore(decodeTask, "lcd_decode", 4096, nullptr, 4, &decode_task, LCD_DECODE_CORE);
+        }
+
         // Initialize state
-        ddram_address = 0x00;
         lcd_state.detected_addr = LCD_I2C_ADDRESS;
         lcd_state.controller_type = "US2066";
-        lcd_state.display_on = true;
-        lcd_state.cursor_on = false;
-        lcd_state.blink_on = false;
 
         // ---- Added: early-out if emulator is disabled at startup (no changes below) ----
         if (!emulator_enabled) {
@@ -236,10 +302,32 @@ namespace LCDMonitor {
         broadcastDisplayState(true);
     }
 
-    void loop() {
-        static uint32_t last_broadcast = 0;
-        const uint32_t now = millis();
+    // Drain the capture ring through the decoder (decoder task only)
+    static void service() {
+        I2CTransaction tx;
+        while (capturePop(tx)) {
+            processI2CTransaction(tx);
+            capture_decoded++;
+            status_ac.store(lcd_core.ac & 0x7F, std::memory_order_relaxed);
+            capture_done.store(capture_tail.load(std::memory_order_relaxed), std::memory_order_release);
+        }
+
+        const uint32_t dropped = capture_dropped.load(std::memory_order_relaxed);
+        if (dropped != capture_dropped_reported) {
+            DLOG_W(LcdCaptureDrop, dropped - capture_dropped_reported, dropped);
+            capture_dropped_reported = dropped;
+        }
+    }
+
+    static void decodeTask(void*) {
+        for (;;) {
+            // The timeout only matters if a notification is ever missed
+            ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(50));
+            service();
+        }
+    }
 
+    void loop() {
         // ---- Added: apply runtime enable/disable without changing existing logic ----
         if (!emulator_enabled) {
             if (i2c_slave_active) {
@@ -247,8 +335,6 @@ namespace LCDMonitor {
                 i2c_slave_active = false;
                 Serial.println("[LCD] Emulator disabled -> I2C slave stopped");
             }
-            // Do not proceed to periodic broadcast while disabled
-            return;
         } else if (!i2c_slave_active && g_sda_pin >= 0 && g_scl_pin >= 0) {
             Wire1.begin(LCD_I2C_ADDRESS, g_sda_pin, g_scl_pin, 0);
             Wire1.onReceive(onI2CReceive);
@@ -256,86 +342,124 @@ namespace LCDMonitor {
             i2c_slave_active = true;
             Serial.println("[LCD] Emulator enabled -> I2C slave started");
         }
-        
-        if (lcd_state.last_update_ms > last_broadcast && 
-            (now - last_broadcast) > 1000) {
-            broadcastDisplayState(false);
-            last_broadcast = now;
-        }
     }
 
     void processI2CTransaction(const I2CTransaction& transaction) {
-        // API compatibility - not used in slave mode
+        if (!transaction.is_write || transaction.length == 0) return;
+
+        // A new write always starts with a control byte
+        if (!transaction.continued) {
+            if (frame_parse == FrameParse::Single) {
+                framing.lone_control++;
+                DLOG_W(LcdLoneControl, frame_control);
+            }
+            frame_parse = FrameParse::Control;
+        }
+
+        decodeLCDCommand(transaction.address, transaction.data, transaction.length);
+        syncStateFromCore();
+        lcd_state.last_update_ms = transaction.timestamp_ms;
+        last_write_ms.store(transaction.timestamp_ms, std::memory_order_release);
     }
 
+    // US2066 I2C grammar: [control (Co=1) payload]* [control (Co=0) payload...]
+    // Framing state carries across records of one write (see processI2CTransaction).
     void decodeLCDCommand(uint8_t addr, const uint8_t* data, uint8_t len) {
-        // API compatibility - not used in slave mode
-    }
+        if (addr != LCD_I2C_ADDRESS) return;
 
-    void broadcastDisplayState(bool force) {
-        ensureUdp();
-        
-        // Create JSON exactly as Python script expects
-        StaticJsonDocument<1024> doc;
-        doc["type"] = "lcd20x4";
-        doc["mode"] = "US2066";
-        doc["addr"] = "0x3C";
-        
-        doc["disp"] = lcd_state.display_on;
-        doc["cur"] = lcd_state.cursor_on;
-        doc["blink"] = lcd_state.blink_on;
-        
-        JsonObject cursor = doc.createNestedObject("cursor");
-        cursor["r"] = lcd_state.cursor_row;
-        cursor["c"] = lcd_state.cursor_col;
-        
-        // Make sure rows are clean strings
-        JsonArray rows = doc.createNestedArray("rows");
-        for (int i = 0; i < 4; i++) {
-            // Ensure each row is exactly 20 characters and null-terminated
-            char clean_row[21];
-            memcpy(clean_row, lcd_state.rows[i], 20);
-            clean_row[20] = '\0';
-            
-            // Replace any non-printable characters with spaces
-            for (int j = 0; j < 20; j++) {
-                if (clean_row[j] < 0x20 || clean_row[j] > 0x7E) {
-                    clean_row[j] = ' ';
+        for (uint8_t i = 0; i < len; i++) {
+            const uint8_t b = data[i];
+
+            if (frame_parse == FrameParse::Control) {
+                frame_control = b;
+                frame_is_data = (b & US2066_CTRL_DC) != 0;
+                frame_parse = (b & US2066_CTRL_CO) ? FrameParse::Single : FrameParse::Stream;
+                framing.control_bytes++;
+                if (b & 0x3F) {
+                    // Reserved bits should be zero; decode by Co and D/C# anyway
+                    framing.reserved_control++;
+                    DLOG_W(LcdReservedControl, b);
                 }
+                DLOG_T(LcdControl, b, (b & US2066_CTRL_CO) ? 1 : 0, frame_is_data ? 1 : 0);
+                continue;
             }
-            
-            rows.add(clean_row);
-        }
-        
-        String json_str;
-        serializeJson(doc, json_str);
-        
-        lcdUdp.beginPacket(IPAddress(255,255,255,255), LCD_MONITOR_UDP_PORT);
-        lcdUdp.print(json_str);
-        lcdUdp.endPacket();
-        
-        if (force) {
-            Serial.printf("[LCD] JSON: %s\n", json_str.c_str());
-            Serial.printf("[LCD] Display:\n");
-            for (int i = 0; i < 4; i++) {
-                Serial.printf("  Row %d: \"", i);
-                for (int j = 0; j < 20; j++) {
-                    char c = lcd_state.rows[i][j];
-                    if (c >= 0x20 && c <= 0x7E) {
-                        Serial.printf("%c", c);
-                    } else {
-                        Serial.printf("?");
-                    }
-                }
-                Serial.printf("\"\n");
+
+            if (frame_parse == FrameParse::Single) {
+                if (frame_is_data) framing.paired_data++; else framing.paired_cmd++;
+                frame_parse = FrameParse::Control;
+            } else {
+                if (frame_is_data) framing.stream_data++; else framing.stream_cmd++;
+            }
+
+            if (frame_is_data) {
+                processHD44780Data(b);
+            } else {
+                processHD44780Command(b);
             }
         }
     }
 
+    void broadcastDisplayState(bool force) {
+        // Sending is owned by the egress task; this just asks it to send now
+        NetEgress::requestBroadcast(force);
+    }
+
     const LCDState& getDisplayState() {
         return lcd_state;
     }
 
+    uint32_t getSnapshot(DisplayFrame& out) {
+        uint32_t retries = 0;
+        for (;;) {
+            const uint32_t s1 = published_seq.load(std::memory_order_acquire);
+            if ((s1 & 1) == 0) {
+                memcpy(&out, &published, sizeof(out));
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (published_seq.load(std::memory_order_relaxed) == s1) break;
+            }
+            // Writer is mid-copy on the other core; it finishes in well under a microsecond
+            if (++retries >= 64) vTaskDelay(1);
+        }
+
+        snapshot_reads.fetch_add(1, std::memory_order_relaxed);
+        if (retries) {
+            snapshot_retries.fetch_add(retries, std::memory_order_relaxed);
+            if (retries > snapshot_max_retries.load(std::memory_order_relaxed)) {
+                snapshot_max_retries.store(retries, std::memory_order_relaxed);
+            }
+        }
+        return retries;
+    }
+
+    uint32_t getGeneration() {
+        return published_gen.load(std::memory_order_acquire);
+    }
+
+    uint32_t getLastWriteMs() {
+        return last_write_ms.load(std::memory_order_acquire);
+    }
+
+    SnapshotStats getSnapshotStats() {
+        SnapshotStats st;
+        st.reads = snapshot_reads.load(std::memory_order_relaxed);
+        st.retries = snapshot_retries.load(std::memory_order_relaxed);
+        st.max_retries = snapshot_max_retries.load(std::memory_order_relaxed);
+        return st;
+    }
+
+    FramingStats getFramingStats() {
+        return framing;
+    }
+
+    CaptureStats getCaptureStats() {
+        CaptureStats st;
+        st.captured   = capture_captured.load(std::memory_order_relaxed);
+        st.decoded    = capture_decoded;
+        st.dropped    = capture_dropped.load(std::memory_order_relaxed);
+        st.high_water = capture_high_water.load(std::memory_order_relaxed);
+        return st;
+    }
+
     bool startI2CSniffer() {
         return i2c_slave_active;
     }
@@ -21,6 +21,17 @@
 #define LCD_MONITOR_UDP_PORT 35182
 #endif
 
+// Depth of the I2C capture ring between the Wire1 slave callback and the decoder.
+// Must be a power of two. Check getCaptureStats().high_water to size it.
+#ifndef LCD_CAPTURE_RING_SIZE
+#define LCD_CAPTURE_RING_SIZE 64
+#endif
+
+// Core the decoder task is pinned to (WiFi/lwIP live on core 0)
+#ifndef LCD_DECODE_CORE
+#define LCD_DECODE_CORE 1
+#endif
+
 namespace LCDMonitor {
 
     // I2C transaction record
@@ -30,6 +41,7 @@ namespace LCDMonitor {
         uint8_t length;
         uint32_t timestamp_ms;
         bool is_write;
+        bool continued = false;    // follow-on record of a write longer than data[]
     };
 
     // LCD display state (decoded from traffic)
@@ -50,14 +62,57 @@ namespace LCDMonitor {
 
         // Status
         bool initialized = false;
-        uint32_t last_update_ms = 0;
+        uint32_t last_update_ms = 0;    // last I2C write (changes even if content does not)
         uint32_t packet_count = 0;
+
+        // Change tracking. generation increments only when a visible cell, the cursor or a
+        // display flag actually changes value; consumers compare it to decide whether to send.
+        uint32_t generation = 0;
+    };
+
+    // Consistent copy of the visible frame handed to readers on other tasks
+    struct DisplayFrame {
+        char rows[4][21];
+        uint8_t cursor_row;
+        uint8_t cursor_col;
+        bool display_on;
+        bool cursor_on;
+        bool blink_on;
+        uint32_t generation;
+    };
+
+    // Snapshot reader contention (seqlock retries)
+    struct SnapshotStats {
+        uint32_t reads = 0;
+        uint32_t retries = 0;       // total re-reads because the writer was mid-update
+        uint32_t max_retries = 0;   // worst single read
+    };
+
+    // I2C capture ring counters (slave callback -> decoder)
+    struct CaptureStats {
+        uint32_t captured = 0;     // transactions pushed by the slave callback
+        uint32_t decoded = 0;      // transactions consumed by the decoder
+        uint32_t dropped = 0;      // transactions lost because the ring was full
+        uint16_t high_water = 0;   // deepest ring occupancy seen since boot
+        uint16_t capacity = LCD_CAPTURE_RING_SIZE;
+    };
+
+    // US2066 I2C framing counters (payload bytes per framing mode)
+    struct FramingStats {
+        uint32_t paired_cmd = 0;        // command bytes after a Co=1 control byte
+        uint32_t paired_data = 0;       // data bytes after a Co=1 control byte
+        uint32_t stream_cmd = 0;        // command bytes in a Co=0 stream
+        uint32_t stream_data = 0;       // data bytes in a Co=0 stream (bulk writes)
+        uint32_t control_bytes = 0;     // control bytes seen
+        uint32_t reserved_control = 0;  // control bytes with reserved bits set
+        uint32_t lone_control = 0;      // Co=1 control bytes with no payload before STOP
     };
 
     // Initialize the LCD monitor (sets up sniffer and/or emulator pins)
     void begin(int sda_pin, int scl_pin);
 
-    // Main loop function - processes captured I2C traffic and periodic broadcasts
+    // Main loop function - applies runtime emulator enable/disable. Capture decoding runs
+    // in its own task (started by begin()) and sending in NetEgress.
     void loop();
 
     // Process captured I2C transaction
@@ -66,12 +121,31 @@ namespace LCDMonitor {
     // Decode LCD command for specific controller type
     void decodeLCDCommand(uint8_t addr, const uint8_t* data, uint8_t len);
 
-    // Send current display state via UDP
+    // Ask the egress task to send the current display state via UDP now
     void broadcastDisplayState(bool force = false);
 
-    // Get current display state (read-only)
+    // Get current display state (read-only). Owned by the decoder; other tasks should use
+    // getSnapshot(), which never returns a half-updated frame.
     const LCDState& getDisplayState();
 
+    // Copy the latest published frame (seqlock; never blocks the decoder).
+    // Returns how many times this read had to retry.
+    uint32_t getSnapshot(DisplayFrame& out);
+
+    // Generation of the latest published frame (cheap change check before getSnapshot)
+    uint32_t getGeneration();
+
+    // millis() of the latest I2C write seen by the decoder (burst/quiet detection)
+    uint32_t getLastWriteMs();
+
+    SnapshotStats getSnapshotStats();
+
+    // Capture ring counters (overflow/drop/high-water) for sizing LCD_CAPTURE_RING_SIZE
+    CaptureStats getCaptureStats();
+
+    // Framing mode counters for the US2066 control-byte grammar
+    FramingStats getFramingStats();
+
     // ---- Runtime control (for WiFiMgr / settings) ----
     // Enable/disable the active US2066/HD44780 emulator at 0x3C on the fly.
     // When disabled: the I2C slave is torn down (bus released).
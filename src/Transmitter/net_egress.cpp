@@ -0,0 +1,863 @@
+// net_egress.cpp
+//
+// Egress task: waits for a decoder notification (or its next deadline), takes one
+// seqlock snapshot and fans it out to UDP and SSE. Each output is scheduled on its own:
+// a changed frame is held until the I2C bus has been quiet for quiet_ms (so half-drawn
+// screens are not sent mid-burst), or until it has been pending for max_stale_ms while
+// the host keeps writing, and consecutive sends are at least min_interval_ms apart.
+
+#include "net_egress.h"
+#include <Arduino.h>
+#include <WiFi.h>
+#include <atomic>
+#include <esp_wifi.h>
+
+#include "lcd_monitor.h"
+#include "lcd_frame.h"
+#include "frame_transport.h"
+#include "frame_cache.h"
+#include "web_emu.h"
+#include "wifimgr.h"
+
+namespace NetEgress {
+
+// Frame links (frame_transport.h). UDP is always on while the station is connected;
+// ESP-NOW runs beside it when Transport::espnow is set.
+static FrameTransport::UdpLink udp_link(LCD_MONITOR_UDP_PORT);
+static FrameTransport::EspNowLink espnow_link;
+static FrameTransport::Link* const links[] = {&udp_link, &espnow_link};
+
+// Receivers subscribed over the control channel (TYPE_JOIN/ALIVE, or the older TYPE_CAPS).
+// They get frames unicast (link-layer retries, full PHY rate) in the best format they
+// decode; JSON is broadcast only while the table is empty, plus the discovery beacon.
+struct Subscriber {
+    FrameTransport::Link* link = nullptr;
+    FrameTransport::Endpoint ep;
+    uint32_t last_seen_ms = 0;
+    uint8_t formats = 0;      // LCDFrame::Format bits
+    uint8_t loss_pct = LCDFrame::kLossUnknown;  // from its last TYPE_ALIVE
+    bool used = false;
+};
+static Subscriber subs[NET_EGRESS_MAX_SUBSCRIBERS];
+
+static inline bool wantsBinary(const Subscriber& s) { return s.used && (s.formats & LCDFrame::FMT_BIN1); }
+static inline bool wantsJson(const Subscriber& s)   { return s.used && !(s.formats & LCDFrame::FMT_BIN1); }
+
+// Binary stream state shared by all peers: keyframe, then deltas against the previous frame
+static LCDFrame::Frame bin_base;        // last frame sent (base of the next delta)
+static bool bin_have_base = false;
+static uint16_t bin_seq = 0;            // seq of bin_base
+static uint32_t bin_key_ms = 0;         // last keyframe
+static uint32_t bin_last_ms = 0;        // last binary frame of any kind
+static bool key_requested = false;      // TYPE_KEYREQ received or a new peer joined
+static LCDFrame::RowDict bin_dict;      // rows the peers can be sent by id (mirrored by them)
+
+// FEC repeat of the last frame, sent fec_repeat_ms later or just before the next frame
+static uint8_t rep_bin[LCDFrame::kMaxPacket];
+static size_t rep_bin_len = 0;
+static char rep_json[LCDJson::kMaxSize + 16];
+static size_t rep_json_len = 0;
+static bool rep_json_bcast = false;
+static bool rep_pending = false;
+static uint32_t rep_due_ms = 0;
+
+static TaskHandle_t egress_task = nullptr;
+static std::atomic<bool> broadcast_pending{false};
+static std::atomic<bool> broadcast_force{false};
+static uint32_t last_bcast_ms = 0;
+
+static std::atomic<uint32_t> stat_wakeups{0};
+static std::atomic<uint32_t> stat_udp{0};
+static std::atomic<uint32_t> stat_sse{0};
+static std::atomic<uint32_t> stat_forced{0};
+static std::atomic<uint32_t> stat_bin_sent{0};
+static std::atomic<uint32_t> stat_ctrl_rx{0};
+static std::atomic<uint32_t> stat_joins{0};
+static std::atomic<uint32_t> stat_leaves{0};
+static std::atomic<uint32_t> stat_expired{0};
+static std::atomic<uint32_t> stat_bcast{0};
+static std::atomic<uint32_t> stat_json_unicast{0};
+static std::atomic<uint8_t>  stat_subs{0};
+static std::atomic<uint8_t>  stat_json_subs{0};
+static std::atomic<uint32_t> stat_key_sent{0};
+static std::atomic<uint32_t> stat_delta_sent{0};
+static std::atomic<uint32_t> stat_bin_bytes{0};
+static std::atomic<uint32_t> stat_keyreq_rx{0};
+static std::atomic<uint32_t> stat_shift_rows{0};
+static std::atomic<uint32_t> stat_dict_rows{0};
+static std::atomic<uint32_t> stat_fec_sent{0};
+static std::atomic<uint32_t> stat_rx_ignored{0};
+static std::atomic<uint32_t> stat_rx_self{0};
+static std::atomic<uint32_t> stat_rx_mirror{0};
+
+static char device_id[13] = "";         // "src" of our JSON frames
+static std::atomic<uint8_t>  stat_bin_peers{0};
+static std::atomic<uint32_t> stat_sent_quiet{0};
+static std::atomic<uint32_t> stat_sent_stale{0};
+static std::atomic<uint32_t> stat_latency_last{0};
+static std::atomic<uint32_t> stat_latency_max{0};
+
+static Schedule schedule;
+static portMUX_TYPE schedule_mux = portMUX_INITIALIZER_UNLOCKED;
+
+static Transport transport;                 // written by setTransport()
+static portMUX_TYPE transport_mux = portMUX_INITIALIZER_UNLOCKED;
+static std::atomic<bool> transport_dirty{true};
+static Transport tx_cfg;                    // egress task's copy
+static std::atomic<uint32_t> stat_mcast{0};
+static std::atomic<uint32_t> stat_mcast_err{0};
+static std::atomic<uint32_t> stat_send_err{0};
+
+// Rate controller. The window counters are only touched by the egress task.
+struct LinkLevel {
+    const char* name;
+    uint16_t min_interval_ms;   // floor for Schedule::min_interval_ms
+    uint16_t keyframe_ms;       // cap for Schedule::keyframe_ms, 0 = unchanged
+    uint16_t fec_repeat_ms;     // FEC repeat added when FEC is off and sends succeed
+};
+static const LinkLevel kLevels[] = {
+    {"good",   0,    0,  0},
+    {"fair", 100, 1000,  0},
+    {"poor", 200, 1000, 40},
+    {"bad",  500,  500, 80},    // every frame is about a keyframe: few, but each one complete
+};
+static const uint8_t kMaxLevel = sizeof(kLevels) / sizeof(kLevels[0]) - 1;
+
+static uint32_t win_start_ms = 0;
+static uint32_t win_sends = 0;
+static uint32_t win_fails = 0;
+static uint32_t win_keyreqs = 0;
+static uint8_t clean_windows = 0;
+static RateState rate;                      // published copy for getRateState()
+static portMUX_TYPE rate_mux = portMUX_INITIALIZER_UNLOCKED;
+
+static const uint32_t SSE_KEEPALIVE_MS = 15000;
+static const uint32_t SUB_TTL_MS       = 15000;   // receivers send TYPE_ALIVE every ~5 s
+static const uint32_t RX_POLL_MS       = 250;     // socket drain cadence while idle
+
+// UDP needs the station connection; ESP-NOW only needs WiFi started
+static bool linkUp(const FrameTransport::Link& link) {
+    if (&link == &udp_link) return udp_link.ready() && WiFiMgr::isConnected();
+    return link.ready();
+}
+
+static void ensureUdp() {
+    if (!udp_link.ready() && WiFiMgr::isConnected()) udp_link.begin();
+}
+
+static void countSubscribers() {
+    uint8_t all = 0, bin = 0, json = 0;
+    for (const Subscriber& p : subs) {
+        if (p.used) all++;
+        if (wantsBinary(p)) bin++;
+        if (wantsJson(p)) json++;
+    }
+    stat_subs.store(all, std::memory_order_relaxed);
+    stat_bin_peers.store(bin, std::memory_order_relaxed);
+    stat_json_subs.store(json, std::memory_order_relaxed);
+}
+
+// Add or refresh a subscriber. Returns true if it is new.
+static bool upsertSubscriber(FrameTransport::Link* link, const FrameTransport::Endpoint& ep, uint8_t formats,
+                             uint8_t loss_pct, uint32_t now) {
+    char who[24];
+    link->format(ep, who, sizeof(who));
+    Subscriber* slot = nullptr;
+    for (Subscriber& p : subs) {
+        if (p.used && p.link == link && p.ep == ep) { slot = &p; break; }
+        if (!p.used && !slot) slot = &p;
+    }
+    if (!slot) {
+        // Table full: replace the subscriber heard from least recently
+        slot = &subs[0];
+        for (Subscriber& p : subs) {
+            if ((int32_t)(p.last_seen_ms - slot->last_seen_ms) < 0) slot = &p;
+        }
+        char old[24];
+        slot->link->format(slot->ep, old, sizeof(old));
+        Serial.printf("[Egress] Subscriber table full, dropping %s\n", old);
+        slot->link->forget(slot->ep);
+        slot->used = false;
+    }
+    const bool added = !slot->used;
+    if (added) {
+        Serial.printf("[Egress] Subscriber %s %s (%s)\n", link->name(), who,
+                      (formats & LCDFrame::FMT_BIN1) ? "bin1" : "json");
+        stat_joins.fetch_add(1, std::memory_order_relaxed);
+    }
+    // A new binary subscriber (or one that changed format) has no base for deltas yet
+    if ((formats & LCDFrame::FMT_BIN1) && (added || !(slot->formats & LCDFrame::FMT_BIN1))) {
+        key_requested = true;
+    }
+    slot->link = link;
+    slot->ep = ep;
+    slot->formats = formats;
+    if (added || loss_pct != LCDFrame::kLossUnknown) slot->loss_pct = loss_pct;
+    slot->last_seen_ms = now;
+    slot->used = true;
+    return added;
+}
+
+static void dropSubscriber(Subscriber& p, const char* why) {
+    char who[24];
+    p.link->format(p.ep, who, sizeof(who));
+    Serial.printf("[Egress] Subscriber %s %s\n", who, why);
+    p.link->forget(p.ep);
+    p.used = false;
+}
+
+static void removeSubscriber(FrameTransport::Link* link, const FrameTransport::Endpoint& ep) {
+    for (Subscriber& p : subs) {
+        if (p.used && p.link == link && p.ep == ep) {
+            dropSubscriber(p, "left");
+            stat_leaves.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+}
+
+// Value of '"key":' in a (possibly truncated) JSON packet: a quoted string or a number
+static bool jsonField(const uint8_t* buf, size_t len, const char* key, char* out, size_t cap) {
+    const size_t klen = strlen(key);
+    for (size_t i = 0; i + klen + 3 < len; i++) {
+        if (buf[i] != '"' || memcmp(buf + i + 1, key, klen) != 0 || buf[i + 1 + klen] != '"' ||
+            buf[i + 2 + klen] != ':') {
+            continue;
+        }
+        size_t j = i + 3 + klen, n = 0;
+        const bool quoted = buf[j] == '"';
+        if (quoted) j++;
+        while (j < len && n + 1 < cap && buf[j] != (quoted ? '"' : ',') && buf[j] != '}') out[n++] = (char)buf[j++];
+        out[n] = '\0';
+        return true;
+    }
+    return false;
+}
+
+// A JSON frame on our port: our own broadcast looped back, a receiver's telemetry mirror,
+// or another sender. None of them is for us.
+static void classifyJson(const FrameTransport::Link* link, const FrameTransport::Endpoint& from,
+                         const uint8_t* buf, size_t len) {
+    char src[16], hop[4];
+    const bool self = (link == &udp_link && from.sameHost(FrameTransport::UdpLink::endpoint(WiFi.localIP(), 0))) ||
+                      (jsonField(buf, len, "src", src, sizeof(src)) && strcmp(src, device_id) == 0);
+    if (self) stat_rx_self.fetch_add(1, std::memory_order_relaxed);
+    else if (jsonField(buf, len, "hop", hop, sizeof(hop)) && atoi(hop) > 0) stat_rx_mirror.fetch_add(1, std::memory_order_relaxed);
+    else stat_rx_ignored.fetch_add(1, std::memory_order_relaxed);
+}
+
+// Handle one control packet from 'from' on 'link'. Returns true if the subscriber wants
+// the current frame now (TYPE_JOIN, or first contact).
+static bool handleControl(FrameTransport::Link* link, const FrameTransport::Endpoint& from,
+                          const uint8_t* buf, size_t len, uint32_t now) {
+    LCDFrame::Packet pkt;
+    if (LCDFrame::parse(buf, len, pkt) != LCDFrame::Result::Ok) {
+        if (buf[0] == '{') classifyJson(link, from, buf, len);
+        else stat_rx_ignored.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    switch (pkt.type) {
+    case LCDFrame::TYPE_CAPS:
+    case LCDFrame::TYPE_JOIN:
+    case LCDFrame::TYPE_ALIVE: {
+        const uint8_t formats = pkt.payload_len >= 1 ? pkt.payload[0] : 0;
+        // JSON frames do not fit small links (ESP-NOW): binary subscribers only there
+        const uint8_t usable = link->mtu() < 512 ? LCDFrame::FMT_BIN1 : (LCDFrame::FMT_JSON | LCDFrame::FMT_BIN1);
+        if (!(formats & usable)) {
+            stat_rx_ignored.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        const uint8_t loss = (pkt.type == LCDFrame::TYPE_ALIVE && pkt.payload_len >= 2)
+                                 ? pkt.payload[1] : LCDFrame::kLossUnknown;
+        const bool added = upsertSubscriber(link, from, formats, loss, now);
+        stat_ctrl_rx.fetch_add(1, std::memory_order_relaxed);
+        return added || pkt.type == LCDFrame::TYPE_JOIN;
+    }
+    case LCDFrame::TYPE_LEAVE:
+        removeSubscriber(link, from);
+        stat_ctrl_rx.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    case LCDFrame::TYPE_KEYREQ:
+        key_requested = true;
+        win_keyreqs++;
+        stat_keyreq_rx.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    default:
+        stat_rx_ignored.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+}
+
+// Read everything queued on every link (our own looped-back broadcasts included) so lwIP
+// buffers never pile up, and handle the control channel. Returns true if a subscriber
+// wants the current frame now.
+static bool drainLinks(uint32_t now) {
+    bool want_frame = false;
+    uint8_t buf[LCDFrame::kMaxPacket];
+    for (FrameTransport::Link* link : links) {
+        if (!linkUp(*link)) continue;
+        FrameTransport::Endpoint from;
+        size_t len;
+        while ((len = link->receive(buf, sizeof(buf), from)) > 0) {
+            if (handleControl(link, from, buf, len, now)) want_frame = true;
+        }
+    }
+
+    for (Subscriber& p : subs) {
+        if (p.used && now - p.last_seen_ms > SUB_TTL_MS) {
+            dropSubscriber(p, "expired");
+            stat_expired.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    countSubscribers();
+    return want_frame;
+}
+
+
+static void countSend(bool ok) {
+    win_sends++;
+    if (!ok) {
+        win_fails++;
+        stat_send_err.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+static void sendBinaryPacket(const uint8_t* buf, size_t len) {
+    for (const Subscriber& p : subs) {
+        if (!wantsBinary(p) || !linkUp(*p.link)) continue;
+        countSend(p.link->sendTo(p.ep, buf, len));
+        stat_bin_sent.fetch_add(1, std::memory_order_relaxed);
+        stat_bin_bytes.fetch_add(len, std::memory_order_relaxed);
+    }
+}
+
+static bool phyRate(uint8_t mbps, wifi_phy_rate_t& out) {
+    switch (mbps) {
+    case 1:  out = WIFI_PHY_RATE_1M_L;  return true;
+    case 2:  out = WIFI_PHY_RATE_2M_L;  return true;
+    case 5:  out = WIFI_PHY_RATE_5M_L;  return true;
+    case 11: out = WIFI_PHY_RATE_11M_L; return true;
+    case 6:  out = WIFI_PHY_RATE_6M;    return true;
+    case 9:  out = WIFI_PHY_RATE_9M;    return true;
+    case 12: out = WIFI_PHY_RATE_12M;   return true;
+    case 18: out = WIFI_PHY_RATE_18M;   return true;
+    case 24: out = WIFI_PHY_RATE_24M;   return true;
+    case 36: out = WIFI_PHY_RATE_36M;   return true;
+    case 48: out = WIFI_PHY_RATE_48M;   return true;
+    case 54: out = WIFI_PHY_RATE_54M;   return true;
+    default: return false;
+    }
+}
+
+// Rate we pinned in the driver, 0 while it runs its own rate control (egress task only;
+// cleared when the station drops, since a reconnect forgets the pin)
+static uint8_t pinned_rate_mbps = 0;
+
+// Take the latest Transport and push it to the links and the driver. Runs on the egress
+// task when the settings change and after every reconnect (the driver forgets the rate).
+static void applyTransport(bool online) {
+    portENTER_CRITICAL(&transport_mux);
+    tx_cfg = transport;
+    portEXIT_CRITICAL(&transport_mux);
+
+    udp_link.setMulticast(tx_cfg.multicast, tx_cfg.group, tx_cfg.ttl);
+
+    if (tx_cfg.espnow && !espnow_link.ready()) {
+        if (espnow_link.begin()) Serial.println("[Egress] ESP-NOW link up");
+    } else if (!tx_cfg.espnow && espnow_link.ready()) {
+        for (Subscriber& p : subs) {
+            if (p.used && p.link == &espnow_link) p.used = false;
+        }
+        countSubscribers();
+        espnow_link.end();
+        Serial.println("[Egress] ESP-NOW link off");
+    }
+
+    if (!online) return;
+    wifi_phy_rate_t rate;
+    if (tx_cfg.phy_rate_mbps && phyRate(tx_cfg.phy_rate_mbps, rate)) {
+        const esp_err_t err = esp_wifi_config_80211_tx_rate(WIFI_IF_STA, rate);
+        if (err == ESP_OK) pinned_rate_mbps = tx_cfg.phy_rate_mbps;
+        Serial.printf("[Egress] PHY rate %u Mbit/s: %s\n", tx_cfg.phy_rate_mbps, err == ESP_OK ? "ok" : "failed");
+    } else if (pinned_rate_mbps) {
+        // The driver has no call that unpins the rate, but it drops it on reconnect, so
+        // reconnecting is how rate control comes back. applyTransport runs again when we're online.
+        Serial.printf("[Egress] PHY rate %u Mbit/s -> driver default, reconnecting\n", pinned_rate_mbps);
+        pinned_rate_mbps = 0;
+        WiFi.reconnect();
+    }
+}
+
+// JSON goes to the broadcast address (or multicast group), or unicast to each subscriber
+// that wants JSON. Only UDP broadcasts it: ESP-NOW receivers find us with a TYPE_JOIN
+// broadcast of their own, since a JSON frame does not fit an ESP-NOW packet.
+static void sendJson(const char* json, size_t len, bool bcast) {
+    const uint8_t* data = (const uint8_t*)json;
+    if (bcast) {
+        if (!linkUp(udp_link)) return;
+        const bool ok = udp_link.broadcast(data, len);
+        countSend(ok);
+        if (!udp_link.multicast()) stat_bcast.fetch_add(1, std::memory_order_relaxed);
+        else if (ok) stat_mcast.fetch_add(1, std::memory_order_relaxed);
+        else stat_mcast_err.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    for (const Subscriber& p : subs) {
+        if (!wantsJson(p) || !linkUp(*p.link) || len > p.link->mtu()) continue;
+        countSend(p.link->sendTo(p.ep, data, len));
+        stat_json_unicast.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+static void clearRepeat() {
+    rep_pending = false;
+    rep_bin_len = 0;
+    rep_json_len = 0;
+}
+
+// Send the pending FEC repeat. Also called right before a newer frame so the repeat is
+// never dropped: a receiver that lost frame N still needs it as the base of N + 1.
+static void flushRepeat() {
+    if (!rep_pending) return;
+    if (rep_bin_len) sendBinaryPacket(rep_bin, rep_bin_len);
+    if (rep_json_len) sendJson(rep_json, rep_json_len, rep_json_bcast);
+    clearRepeat();
+    stat_fec_sent.fetch_add(1, std::memory_order_relaxed);
+}
+
+static void queueRepeat(uint32_t now, const Schedule& sch) {
+    rep_pending = true;
+    rep_due_ms = now + sch.fec_repeat_ms;
+}
+
+// Send 'frame' to every binary subscriber: a keyframe when due (interval, request, no
+// base), otherwise a delta against the previous frame if that is smaller.
+// Callers flushRepeat() first.
+static void sendBinaryFrame(const LCDMonitor::DisplayFrame& frame, uint32_t now, const Schedule& sch) {
+    if (stat_bin_peers.load(std::memory_order_relaxed) == 0) {
+        bin_have_base = false;
+        return;
+    }
+
+    LCDFrame::Frame f;
+    FrameCache::toFrame(frame, f);
+
+    uint8_t buf[LCDFrame::kMaxPacket];
+    const uint16_t seq = (uint16_t)(bin_seq + 1);
+    // A peer that asked (or just joined) clears its dictionary on this keyframe; so do we.
+    // Peers already in sync keep theirs: it still holds every row we learn from here on.
+    const bool resync = !bin_have_base || key_requested;
+    const bool key = resync || (now - bin_key_ms) >= sch.keyframe_ms;
+    LCDFrame::DeltaInfo info;
+    size_t len = key ? 0 : LCDFrame::encodeDelta(buf, sizeof(buf), seq, bin_seq, bin_base, f, &info, &bin_dict);
+    if (len) {
+        stat_delta_sent.fetch_add(1, std::memory_order_relaxed);
+        stat_shift_rows.fetch_add(info.shift_rows, std::memory_order_relaxed);
+        stat_dict_rows.fetch_add(info.dict_rows, std::memory_order_relaxed);
+    } else {
+        if (resync) LCDFrame::dictClear(bin_dict);
+        len = LCDFrame::encodeFull(buf, sizeof(buf), seq, f);
+        bin_key_ms = now;
+        key_requested = false;
+        stat_key_sent.fetch_add(1, std::memory_order_relaxed);
+    }
+    bin_seq = seq;
+    bin_base = f;
+    bin_have_base = true;
+    LCDFrame::dictLearn(bin_dict, f);
+    bin_last_ms = now;
+
+    sendBinaryPacket(buf, len);
+    if (sch.fec_repeat_ms) {
+        memcpy(rep_bin, buf, len);
+        rep_bin_len = LCDFrame::markRepeat(rep_bin, len);
+        queueRepeat(now, sch);
+    }
+}
+
+static void sendJsonFrame(const LCDMonitor::DisplayFrame& frame, bool force, bool bcast,
+                          uint32_t now, const Schedule& sch) {
+    // Encoded once per generation and shared with the web emulator (frame_cache.h)
+    char json[LCDJson::kMaxSize];
+    const size_t len = FrameCache::json(frame, json, sizeof(json));
+    if (!len) return;
+
+    sendJson(json, len, bcast);
+    if (bcast) last_bcast_ms = now;
+
+    if (sch.fec_repeat_ms) {
+        // Same frame again; receivers that got the original drop it by "gen"
+        memcpy(rep_json, json, len + 1);
+        rep_json_len = LCDJson::markRepeat(rep_json, len, sizeof(rep_json));
+        rep_json_bcast = bcast;
+        queueRepeat(now, sch);
+    }
+
+    if (force) {
+        Serial.printf("[LCD] JSON: %s\n", json);
+        Serial.printf("[LCD] Display:\n");
+        for (int i = 0; i < 4; i++) {
+            Serial.printf("  Row %d: \"%.20s\"\n", i, frame.rows[i]);
+        }
+    }
+}
+
+// One frame to everyone: binary subscribers, JSON subscribers, and the broadcast address
+// while nobody is subscribed (or when the beacon or a forced send is due)
+static void sendUdpFrame(const LCDMonitor::DisplayFrame& frame, bool force, uint32_t now, const Schedule& sch) {
+    ensureUdp();
+    flushRepeat();
+    sendBinaryFrame(frame, now, sch);
+
+    const bool bcast = force || stat_subs.load(std::memory_order_relaxed) == 0 ||
+                       (now - last_bcast_ms) >= NET_EGRESS_BEACON_MS;
+    if (bcast || stat_json_subs.load(std::memory_order_relaxed)) {
+        sendJsonFrame(frame, force, bcast, now, sch);
+    }
+    stat_udp.fetch_add(1, std::memory_order_relaxed);
+}
+
+// Worst link level the last window justifies
+static uint8_t gradeWindow(uint8_t fail_pct, int8_t rssi, uint8_t loss_pct, uint32_t keyreqs) {
+    uint8_t t = 0;
+    if (fail_pct >= 30) t = max<uint8_t>(t, 3);
+    else if (fail_pct >= 15) t = max<uint8_t>(t, 2);
+    else if (fail_pct >= 5) t = max<uint8_t>(t, 1);
+    if (rssi != 0) {
+        if (rssi <= -85) t = max<uint8_t>(t, 3);
+        else if (rssi <= -78) t = max<uint8_t>(t, 2);
+        else if (rssi <= -70) t = max<uint8_t>(t, 1);
+    }
+    if (loss_pct != LCDFrame::kLossUnknown) {
+        if (loss_pct >= 20) t = max<uint8_t>(t, 3);
+        else if (loss_pct >= 8) t = max<uint8_t>(t, 2);
+        else if (loss_pct >= 2) t = max<uint8_t>(t, 1);
+    }
+    if (keyreqs >= 3) t = max<uint8_t>(t, 2);
+    else if (keyreqs >= 1) t = max<uint8_t>(t, 1);
+    return t;
+}
+
+// Close the measurement window when it is due and return the UDP timings for the current
+// link level. SSE (TCP, its own flow control) keeps the configured schedule.
+static Schedule rateControl(const Schedule& sch, uint32_t now, bool udp_ok) {
+    RateState st;
+    portENTER_CRITICAL(&rate_mux);
+    st = rate;
+    portEXIT_CRITICAL(&rate_mux);
+    st.enabled = sch.adaptive;
+
+    if (!sch.adaptive) {
+        st.level = 0;
+        clean_windows = 0;
+    } else if (!udp_ok) {
+        win_start_ms = now;             // nothing to measure offline; keep the last level
+        win_sends = win_fails = win_keyreqs = 0;
+    } else if (now - win_start_ms >= NET_EGRESS_RATE_WINDOW_MS) {
+        uint8_t loss = LCDFrame::kLossUnknown;
+        for (const Subscriber& p : subs) {
+            if (!p.used || p.loss_pct == LCDFrame::kLossUnknown) continue;
+            if (loss == LCDFrame::kLossUnknown || p.loss_pct > loss) loss = p.loss_pct;
+        }
+        st.fail_pct = win_sends ? (uint8_t)(win_fails * 100 / win_sends) : 0;
+        st.rssi = WiFi.RSSI();
+        st.loss_pct = loss;
+        st.keyreqs = (uint8_t)min<uint32_t>(win_keyreqs, 255);
+        st.congested = st.fail_pct >= 5;
+
+        const uint8_t target = gradeWindow(st.fail_pct, st.rssi, st.loss_pct, win_keyreqs);
+        const uint8_t before = st.level;
+        if (target > st.level) {
+            st.level = target;
+            clean_windows = 0;
+        } else if (target < st.level && ++clean_windows >= NET_EGRESS_RATE_RECOVER_WINDOWS) {
+            st.level--;
+            clean_windows = 0;
+        } else if (target == st.level) {
+            clean_windows = 0;
+        }
+        if (st.level != before) {
+            st.changes++;
+            Serial.printf("[Egress] Link %s -> %s (fail %u%%, rssi %d, loss %u%%, keyreq %u)\n",
+                          kLevels[before].name, kLevels[st.level].name, st.fail_pct, st.rssi,
+                          loss == LCDFrame::kLossUnknown ? 0 : loss, (unsigned)win_keyreqs);
+        }
+        win_start_ms = now;
+        win_sends = win_fails = win_keyreqs = 0;
+    }
+
+    const LinkLevel& L = kLevels[min(st.level, kMaxLevel)];
+    Schedule eff = sch;
+    if (eff.min_interval_ms < L.min_interval_ms) eff.min_interval_ms = L.min_interval_ms;
+    if (L.keyframe_ms && eff.keyframe_ms > L.keyframe_ms) eff.keyframe_ms = L.keyframe_ms;
+    if (st.congested && st.level) eff.fec_repeat_ms = 0;
+    else if (!eff.fec_repeat_ms) eff.fec_repeat_ms = L.fec_repeat_ms;
+
+    st.name = L.name;
+    st.min_interval_ms = eff.min_interval_ms;
+    st.keyframe_ms = eff.keyframe_ms;
+    st.fec_repeat_ms = eff.fec_repeat_ms;
+    portENTER_CRITICAL(&rate_mux);
+    rate = st;
+    portEXIT_CRITICAL(&rate_mux);
+    return eff;
+}
+
+// One output's scheduler state: what it last sent and since when it has been behind
+struct Output {
+    uint32_t gen = 0;         // generation last sent
+    uint32_t sent_ms = 0;     // when it was sent
+    uint32_t dirty_ms = 0;    // when a newer generation was first seen
+    bool dirty = false;
+};
+
+enum class Due : uint8_t { No, Quiet, Stale };
+
+// Decide whether 'out' sends now. If not, lower next_ms to the time it could become due.
+static Due scheduleOutput(Output& out, uint32_t gen, uint32_t now, uint32_t last_write,
+                          const Schedule& sch, uint32_t& next_ms) {
+    if (gen == out.gen) {
+        out.dirty = false;
+        return Due::No;
+    }
+    if (!out.dirty) {
+        out.dirty = true;
+        out.dirty_ms = now;
+    }
+
+    const uint32_t since_sent = now - out.sent_ms;
+    const uint32_t quiet = now - last_write;
+    const uint32_t age = now - out.dirty_ms;
+    const uint32_t wait_min   = since_sent >= sch.min_interval_ms ? 0 : sch.min_interval_ms - since_sent;
+    const uint32_t wait_quiet = quiet >= sch.quiet_ms ? 0 : sch.quiet_ms - quiet;
+    const uint32_t wait_stale = age >= sch.max_stale_ms ? 0 : sch.max_stale_ms - age;
+
+    const uint32_t wait = max(wait_min, min(wait_quiet, wait_stale));
+    if (wait == 0) return wait_quiet == 0 ? Due::Quiet : Due::Stale;
+    if (wait < next_ms) next_ms = wait;
+    return Due::No;
+}
+
+static void egressTask(void*) {
+    Output udp_out, sse_out;
+    udp_out.sent_ms = sse_out.sent_ms = millis() - 0x10000;
+    uint32_t last_ka_ms = millis();
+    bool was_online = false;
+    TickType_t wait = 0;    // first pass picks up requests made before the task existed
+
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, wait);
+        stat_wakeups.fetch_add(1, std::memory_order_relaxed);
+
+        // Read the last write time before 'now' so the quiet interval can never go negative
+        const uint32_t last_write = LCDMonitor::getLastWriteMs();
+        const uint32_t now = millis();
+        const uint32_t gen = LCDMonitor::getGeneration();
+        const bool pending = broadcast_pending.exchange(false);
+        const bool force = broadcast_force.exchange(false);
+        // The driver drops the configured PHY rate when the station reconnects
+        const bool online = WiFiMgr::isConnected();
+        if (!online) pinned_rate_mbps = 0;
+        if ((online && !was_online) || transport_dirty.load()) {
+            applyTransport(online);
+            transport_dirty.store(!online);     // the rate still has to go in on connect
+        }
+        was_online = online;
+        if (online) ensureUdp();
+        // Frames can go out on UDP (station connected) or ESP-NOW (works without the AP)
+        const bool udp_ok = LCDMonitor::isEmulatorEnabled() && (online || espnow_link.ready());
+        const bool joined = udp_ok && drainLinks(now);
+
+        Schedule sch;
+        portENTER_CRITICAL(&schedule_mux);
+        sch = schedule;
+        portEXIT_CRITICAL(&schedule_mux);
+        const Schedule paced = rateControl(sch, now, udp_ok);    // UDP timings for this link
+
+        uint32_t next_ms = SSE_KEEPALIVE_MS - min(SSE_KEEPALIVE_MS, now - last_ka_ms);
+
+        const Due sse_due = scheduleOutput(sse_out, gen, now, last_write, sch, next_ms);
+        Due udp_due = Due::No;
+        if (udp_ok) {
+            udp_due = scheduleOutput(udp_out, gen, now, last_write, paced, next_ms);
+        } else if (gen != udp_out.gen && next_ms > 1000) {
+            // Offline: re-check once a second so the latest frame goes out on reconnect
+            next_ms = 1000;
+        }
+        const bool want_udp = udp_ok && (pending || joined || udp_due != Due::No);
+
+        if (sse_due != Due::No || want_udp) {
+            LCDMonitor::DisplayFrame frame;
+            LCDMonitor::getSnapshot(frame);
+
+            if (sse_due != Due::No) {
+                WebEmu::pushFrame(frame);
+                sse_out.gen = frame.generation;
+                sse_out.sent_ms = now;
+                sse_out.dirty = false;
+                last_ka_ms = now;
+                stat_sse.fetch_add(1, std::memory_order_relaxed);
+            }
+            if (want_udp) {
+                sendUdpFrame(frame, force, now, paced);
+                if (udp_out.dirty) {
+                    const uint32_t latency = now - udp_out.dirty_ms;
+                    stat_latency_last.store(latency, std::memory_order_relaxed);
+                    if (latency > stat_latency_max.load(std::memory_order_relaxed)) {
+                        stat_latency_max.store(latency, std::memory_order_relaxed);
+                    }
+                }
+                if (udp_due == Due::Quiet) stat_sent_quiet.fetch_add(1, std::memory_order_relaxed);
+                if (udp_due == Due::Stale) stat_sent_stale.fetch_add(1, std::memory_order_relaxed);
+                udp_out.gen = frame.generation;
+                udp_out.sent_ms = now;
+                udp_out.dirty = false;
+            }
+        }
+
+        // Binary subscribers get a keyframe on request and a refresh keyframe while the
+        // screen is static, so a lost delta is repaired within one keyframe interval. The
+        // refresh is forced by sendBinaryFrame's own interval check (bin_key_ms <= bin_last_ms)
+        // and is not a resync: peers in sync keep their row dictionary across it.
+        if (udp_ok && !want_udp && stat_bin_peers.load(std::memory_order_relaxed) &&
+            (key_requested || (now - bin_last_ms) >= paced.keyframe_ms)) {
+            LCDMonitor::DisplayFrame frame;
+            LCDMonitor::getSnapshot(frame);
+            flushRepeat();
+            sendBinaryFrame(frame, now, paced);
+        }
+
+        // Discovery beacon: with everyone on unicast, still broadcast the screen now and then
+        // so new receivers see the "fmt" advertisement and can subscribe
+        if (udp_ok && !want_udp && stat_subs.load(std::memory_order_relaxed) &&
+            (now - last_bcast_ms) >= NET_EGRESS_BEACON_MS) {
+            LCDMonitor::DisplayFrame frame;
+            LCDMonitor::getSnapshot(frame);
+            flushRepeat();
+            sendJsonFrame(frame, false, true, now, paced);
+        }
+
+        if (rep_pending) {
+            if (!udp_ok) clearRepeat();     // offline: the latest frame goes out on reconnect
+            else if ((int32_t)(now - rep_due_ms) >= 0) flushRepeat();
+            else if (rep_due_ms - now < next_ms) next_ms = rep_due_ms - now;
+        }
+
+        // Keep-alive so webviews never stall even if the LCD is quiet
+        if (now - last_ka_ms >= SSE_KEEPALIVE_MS) {
+            WebEmu::keepAlive();
+            last_ka_ms = now;
+        }
+
+        // Web viewers: owed SSE frames
+        const uint32_t web_ms = WebEmu::service(now);
+        if (web_ms && web_ms < next_ms) next_ms = web_ms;
+
+        // Sleep until woken by the decoder or until the earliest pending deadline
+        if (udp_ok && next_ms > RX_POLL_MS) next_ms = RX_POLL_MS;
+        wait = pdMS_TO_TICKS(next_ms ? next_ms : 1);
+    }
+}
+
+void begin() {
+    if (egress_task) return;
+    snprintf(device_id, sizeof(device_id), "%012llx", (unsigned long long)ESP.getEfuseMac());
+    xTaskCreatePinnedToCore(egressTask, "lcd_egress", 6144, nullptr, 3, &egress_task, NET_EGRESS_CORE);
+    Serial.printf("[Egress] Network egress task on core %d\n", NET_EGRESS_CORE);
+}
+
+void notifyFrame() {
+    if (egress_task) xTaskNotifyGive(egress_task);
+}
+
+void requestBroadcast(bool force) {
+    if (force) {
+        broadcast_force.store(true);
+        stat_forced.fetch_add(1, std::memory_order_relaxed);
+    }
+    broadcast_pending.store(true);
+    notifyFrame();
+}
+
+void setSchedule(const Schedule& sch) {
+    portENTER_CRITICAL(&schedule_mux);
+    schedule = sch;
+    portEXIT_CRITICAL(&schedule_mux);
+    notifyFrame();
+}
+
+void setTransport(const Transport& t) {
+    portENTER_CRITICAL(&transport_mux);
+    transport = t;
+    portEXIT_CRITICAL(&transport_mux);
+    transport_dirty.store(true);
+    notifyFrame();
+}
+
+Transport getTransport() {
+    portENTER_CRITICAL(&transport_mux);
+    const Transport t = transport;
+    portEXIT_CRITICAL(&transport_mux);
+    return t;
+}
+
+bool validPhyRate(uint8_t mbps) {
+    wifi_phy_rate_t rate;
+    return mbps == 0 || phyRate(mbps, rate);
+}
+
+Schedule getSchedule() {
+    portENTER_CRITICAL(&schedule_mux);
+    const Schedule sch = schedule;
+    portEXIT_CRITICAL(&schedule_mux);
+    return sch;
+}
+
+Stats getStats() {
+    Stats st;
+    st.wakeups  = stat_wakeups.load(std::memory_order_relaxed);
+    st.udp_sent = stat_udp.load(std::memory_order_relaxed);
+    st.sse_sent = stat_sse.load(std::memory_order_relaxed);
+    st.forced   = stat_forced.load(std::memory_order_relaxed);
+    st.bin_sent = stat_bin_sent.load(std::memory_order_relaxed);
+    st.bin_peers = stat_bin_peers.load(std::memory_order_relaxed);
+    st.ctrl_rx  = stat_ctrl_rx.load(std::memory_order_relaxed);
+    st.subscribers = stat_subs.load(std::memory_order_relaxed);
+    st.joins    = stat_joins.load(std::memory_order_relaxed);
+    st.leaves   = stat_leaves.load(std::memory_order_relaxed);
+    st.expired  = stat_expired.load(std::memory_order_relaxed);
+    st.bcast_sent = stat_bcast.load(std::memory_order_relaxed);
+    st.mcast_sent = stat_mcast.load(std::memory_order_relaxed);
+    st.mcast_errors = stat_mcast_err.load(std::memory_order_relaxed);
+    st.json_unicast = stat_json_unicast.load(std::memory_order_relaxed);
+    st.key_sent = stat_key_sent.load(std::memory_order_relaxed);
+    st.delta_sent = stat_delta_sent.load(std::memory_order_relaxed);
+    st.bin_bytes = stat_bin_bytes.load(std::memory_order_relaxed);
+    st.keyreq_rx = stat_keyreq_rx.load(std::memory_order_relaxed);
+    st.shift_rows = stat_shift_rows.load(std::memory_order_relaxed);
+    st.dict_rows = stat_dict_rows.load(std::memory_order_relaxed);
+    st.fec_sent = stat_fec_sent.load(std::memory_order_relaxed);
+    st.send_errors = stat_send_err.load(std::memory_order_relaxed);
+    st.espnow_up = espnow_link.ready();
+    st.espnow_dropped = espnow_link.dropped();
+    st.rx_ignored = stat_rx_ignored.load(std::memory_order_relaxed);
+    st.rx_self = stat_rx_self.load(std::memory_order_relaxed);
+    st.rx_mirror = stat_rx_mirror.load(std::memory_order_relaxed);
+    st.sent_quiet = stat_sent_quiet.load(std::memory_order_relaxed);
+    st.sent_stale = stat_sent_stale.load(std::memory_order_relaxed);
+    st.latency_last_ms = stat_latency_last.load(std::memory_order_relaxed);
+    st.latency_max_ms  = stat_latency_max.load(std::memory_order_relaxed);
+    return st;
+}
+
+const char* deviceId() {
+    return device_id;
+}
+
+RateState getRateState() {
+    portENTER_CRITICAL(&rate_mux);
+    const RateState st = rate;
+    portEXIT_CRITICAL(&rate_mux);
+    return st;
+}
+
+} // namespace NetEgress
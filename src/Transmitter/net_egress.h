@@ -0,0 +1,188 @@
+// net_egress.h
+//
+// Network egress stage of the Transmitter pipeline.
+// One FreeRTOS task pinned to the WiFi core (core 0) owns the frame links and the
+// web emulator's SSE pushes. The I2C decode task (core 1) wakes it with a task
+// notification whenever a new display generation is published, so nothing polls and no
+// two tasks ever touch the socket at once. Sends are coalesced per write burst (Schedule).
+
+#pragma once
+
+#include <stdint.h>
+
+#ifndef NET_EGRESS_CORE
+#define NET_EGRESS_CORE 0
+#endif
+
+// Frame scheduler defaults (ms). A frame goes out once the I2C bus has been quiet for
+// QUIET_MS after the last write (end of a redraw burst), or once a change has waited
+// MAX_STALE_MS during continuous writes; never closer together than MIN_INTERVAL_MS.
+#ifndef NET_EGRESS_QUIET_MS
+#define NET_EGRESS_QUIET_MS 8
+#endif
+#ifndef NET_EGRESS_MIN_INTERVAL_MS
+#define NET_EGRESS_MIN_INTERVAL_MS 50
+#endif
+#ifndef NET_EGRESS_MAX_STALE_MS
+#define NET_EGRESS_MAX_STALE_MS 250
+#endif
+
+// Binary stream keyframe interval (ms); deltas in between
+#ifndef NET_EGRESS_KEYFRAME_MS
+#define NET_EGRESS_KEYFRAME_MS 2000
+#endif
+
+// FEC: repeat every UDP frame (JSON broadcast and binary) this many ms after the original,
+// marked as a repeat, so a receiver recovers a single lost frame without a round trip.
+// 0 = off. 802.11 never retransmits broadcast frames.
+#ifndef NET_EGRESS_FEC_REPEAT_MS
+#define NET_EGRESS_FEC_REPEAT_MS 0
+#endif
+
+// Receivers that can subscribe (unicast) at once, and how often the JSON frame is still
+// broadcast while everyone is on unicast (discovery beacon for new receivers)
+#ifndef NET_EGRESS_MAX_SUBSCRIBERS
+#define NET_EGRESS_MAX_SUBSCRIBERS 8
+#endif
+#ifndef NET_EGRESS_BEACON_MS
+#define NET_EGRESS_BEACON_MS 2000
+#endif
+
+// Where JSON goes when it is not unicast to subscribers (no subscribers, beacon, forced):
+// the broadcast address, or a multicast group that only hosts which joined it receive.
+#ifndef NET_EGRESS_MULTICAST
+#define NET_EGRESS_MULTICAST 0
+#endif
+#ifndef NET_EGRESS_MCAST_GROUP
+#define NET_EGRESS_MCAST_GROUP 239, 255, 76, 67
+#endif
+#ifndef NET_EGRESS_MCAST_TTL
+#define NET_EGRESS_MCAST_TTL 1
+#endif
+
+// Also stream over ESP-NOW (frame_transport.h): binary frames straight to receivers on the
+// same channel, no AP hop. UDP keeps running beside it.
+#ifndef NET_EGRESS_ESPNOW
+#define NET_EGRESS_ESPNOW 0
+#endif
+
+// Station transmit PHY rate in Mbit/s (1, 2, 5, 11, 6, 9, 12, 18, 24, 36, 48, 54). The driver
+// pins it for everything the station sends, not only group frames: unicast subscribers, the web
+// UI and OTA lose rate adaptation too. 0 = driver default (rate control on, group frames at the
+// lowest basic rate).
+#ifndef NET_EGRESS_PHY_RATE_MBPS
+#define NET_EGRESS_PHY_RATE_MBPS 0
+#endif
+
+// Adaptive rate control. Every RATE_WINDOW_MS the egress task grades the UDP link from
+// send failures (WiFi TX buffers full), RSSI and receiver feedback (keyframe requests,
+// loss reported in TYPE_ALIVE) and moves between link levels. Above "good", a level sends
+// fewer UDP frames, refreshes keyframes sooner and adds FEC repeats (none while sends are
+// failing). It degrades at once and recovers one level per RATE_RECOVER_WINDOWS clean windows.
+#ifndef NET_EGRESS_ADAPTIVE
+#define NET_EGRESS_ADAPTIVE 1
+#endif
+#ifndef NET_EGRESS_RATE_WINDOW_MS
+#define NET_EGRESS_RATE_WINDOW_MS 1000
+#endif
+#ifndef NET_EGRESS_RATE_RECOVER_WINDOWS
+#define NET_EGRESS_RATE_RECOVER_WINDOWS 5
+#endif
+
+namespace NetEgress {
+
+    struct Schedule {
+        uint16_t quiet_ms = NET_EGRESS_QUIET_MS;
+        uint16_t min_interval_ms = NET_EGRESS_MIN_INTERVAL_MS;
+        uint16_t max_stale_ms = NET_EGRESS_MAX_STALE_MS;
+        uint16_t keyframe_ms = NET_EGRESS_KEYFRAME_MS;     // binary stream keyframe interval
+        uint16_t fec_repeat_ms = NET_EGRESS_FEC_REPEAT_MS; // repeat delay, 0 = FEC off
+        bool adaptive = NET_EGRESS_ADAPTIVE;                // rate controller may tighten the above
+    };
+
+    // Rate controller state; the UDP stream runs on the effective timings
+    struct RateState {
+        bool enabled = false;
+        uint8_t level = 0;              // 0 good, 1 fair, 2 poor, 3 bad
+        const char* name = "good";
+        bool congested = false;         // sends are failing: no FEC repeats added
+        int8_t rssi = 0;                // dBm at the last window, 0 = not connected
+        uint8_t fail_pct = 0;           // UDP sends that failed in the last window
+        uint8_t loss_pct = 0xFF;        // worst loss a subscriber reported, 0xFF = none reported
+        uint8_t keyreqs = 0;            // keyframe requests in the last window
+        uint16_t min_interval_ms = 0;   // effective UDP timings
+        uint16_t keyframe_ms = 0;
+        uint16_t fec_repeat_ms = 0;
+        uint32_t changes = 0;           // level changes since boot
+    };
+
+    struct Transport {
+        bool multicast = NET_EGRESS_MULTICAST;
+        uint8_t group[4] = {NET_EGRESS_MCAST_GROUP};
+        uint8_t ttl = NET_EGRESS_MCAST_TTL;
+        uint8_t phy_rate_mbps = NET_EGRESS_PHY_RATE_MBPS;
+        bool espnow = NET_EGRESS_ESPNOW;
+    };
+
+    struct Stats {
+        uint32_t wakeups = 0;       // notifications/timeouts handled
+        uint32_t udp_sent = 0;      // UDP frames sent
+        uint32_t sse_sent = 0;      // SSE frame pushes
+        uint32_t forced = 0;        // explicit broadcast requests (boot, /udp/ping)
+        uint32_t bin_sent = 0;      // binary frames sent (one per subscriber per frame)
+        uint32_t ctrl_rx = 0;       // TYPE_JOIN/ALIVE/LEAVE/CAPS control packets received
+        uint32_t joins = 0;         // subscribers added
+        uint32_t leaves = 0;        // subscribers removed by TYPE_LEAVE
+        uint32_t expired = 0;       // subscribers dropped after SUB_TTL without a keep-alive
+        uint32_t bcast_sent = 0;    // JSON broadcasts (no subscribers, beacon or forced)
+        uint32_t mcast_sent = 0;    // the same, sent to the multicast group instead
+        uint32_t mcast_errors = 0;  // multicast socket/send failures
+        uint32_t json_unicast = 0;  // JSON frames unicast (one per JSON subscriber per frame)
+        uint8_t subscribers = 0;    // live subscribers
+        bool espnow_up = false;     // ESP-NOW link running
+        uint32_t espnow_dropped = 0;    // ESP-NOW packets dropped, receive queue full
+        uint32_t key_sent = 0;      // binary keyframes (TYPE_FULL) encoded
+        uint32_t delta_sent = 0;    // binary deltas encoded
+        uint32_t bin_bytes = 0;     // binary payload bytes sent (all peers)
+        uint32_t keyreq_rx = 0;     // keyframe requests from receivers
+        uint32_t shift_rows = 0;    // delta rows sent as a shift op (scrolling text)
+        uint32_t dict_rows = 0;     // delta rows sent as a row dictionary reference
+        uint32_t fec_sent = 0;      // FEC repeats sent (one per frame, JSON and binary together)
+        uint32_t send_errors = 0;   // UDP sends the stack refused (TX buffers full, no route)
+        uint32_t rx_ignored = 0;    // other packets drained from the links (other senders' frames etc.)
+        uint32_t rx_self = 0;       // our own broadcasts looped back
+        uint32_t rx_mirror = 0;     // telemetry mirrors (JSON "hop" > 0) from receivers
+        uint8_t bin_peers = 0;      // live subscribers taking binary frames
+        uint32_t sent_quiet = 0;    // UDP frames sent after the bus went quiet
+        uint32_t sent_stale = 0;    // UDP frames forced out by the staleness bound
+        uint32_t latency_last_ms = 0;   // first change -> UDP send, latest frame
+        uint32_t latency_max_ms = 0;    // worst since boot
+    };
+
+    // Create the egress task. Call after WiFiMgr::begin(), LCDMonitor::begin() and WebEmu::begin().
+    void begin();
+
+    // Decoder -> egress: a new display generation was published. Safe from any task.
+    void notifyFrame();
+
+    // Ask for a UDP frame to go out now regardless of throttling (force also logs it).
+    void requestBroadcast(bool force);
+
+    // Replace the frame scheduler timings (takes effect on the next wake-up)
+    void setSchedule(const Schedule& sch);
+    Schedule getSchedule();
+
+    // Replace the group transport, ESP-NOW and PHY rate (applied by the egress task, now and after
+    // every reconnect). Callers persist it; see WiFiMgr.
+    void setTransport(const Transport& t);
+    Transport getTransport();
+
+    // True for 0 (driver default) and the rates NET_EGRESS_PHY_RATE_MBPS accepts
+    bool validPhyRate(uint8_t mbps);
+
+    Stats getStats();
+    RateState getRateState();
+
+    // This device's source ID ("src" in JSON frames): the eFuse MAC as 12 hex digits
+    const char* deviceId();
+}
@@ -0,0 +1,139 @@
+const lcd=document.getElementById('lcd');
+const msg=document.getElementById('nodata');
+const mdisp=document.getElementById('mdisp');
+const mcur=document.getElementById('mcur');
+const mblink=document.getElementById('mblink');
+const mpos=document.getElementById('mpos');
+let haveData=false;
+
+// The 80 cells are built once; a frame only rewrites the cells whose character changed.
+// Updates are coalesced to one draw per animation frame (latest state wins), so a
+// marquee costs a few text nodes per frame and no layout of the grid.
+const cells=[], shown=[];
+for(let r=0;r<4;r++){
+  const row=document.createElement('div'); row.className='row';
+  for(let c=0;c<20;c++){
+    const d=document.createElement('div'); d.className='cell';
+    d.textContent=' ';
+    row.appendChild(d);
+    cells.push(d); shown.push(' ');
+  }
+  lcd.appendChild(row);
+}
+let pending=null, queued=false, curIdx=-1, curCls='', meta='';
+
+function draw(){
+  queued=false;
+  const s=pending; pending=null;
+  if(!s) return;
+  const rows=s.rows||[];
+  for(let r=0;r<4;r++){
+    const txt=rows[r]||'';
+    for(let c=0;c<20;c++){
+      const i=r*20+c, ch=txt[c]||' ';
+      if(shown[i]!==ch){ shown[i]=ch; cells[i].textContent=ch; }
+    }
+  }
+  lcd.classList.toggle('off', !s.disp);
+
+  // Cursor: underline and/or blinking block on its cell
+  const p=s.cursor, ok=p && typeof p.r==='number' && typeof p.c==='number' && p.r<4 && p.c<20;
+  const idx=ok && (s.cur||s.blink) ? p.r*20+p.c : -1;
+  const cls=(s.cur?'cur ':'')+(s.blink?'blk':'');
+  if(idx!==curIdx || cls!==curCls){
+    if(curIdx>=0) cells[curIdx].classList.remove('cur','blk');
+    if(idx>=0){ if(s.cur) cells[idx].classList.add('cur'); if(s.blink) cells[idx].classList.add('blk'); }
+    curIdx=idx; curCls=cls;
+  }
+
+  const m=[s.disp,s.cur,s.blink,ok?p.r+','+p.c:''].join('|');
+  if(m!==meta){
+    meta=m;
+    mdisp.textContent = s.disp ? 'on' : 'off';
+    mcur.textContent  = s.cur ? 'on' : 'off';
+    mblink.textContent= s.blink ? 'on' : 'off';
+    if(ok) mpos.textContent = p.r + ',' + p.c;
+  }
+}
+
+function apply(state){
+  if(!state) return;
+  if(!haveData){ haveData=true; msg.style.display='none'; }
+  pending=state;
+  if(!queued){ queued=true; requestAnimationFrame(draw); }
+}
+
+// Initial fetch
+fetch('/emu/state',{cache:'no-store'}).then(r=>r.json()).then(j=>{
+  if(j && j.rows && j.rows.length>0 && j.rows.some(line=>line.trim()!=="")) apply(j);
+}).catch(()=>{});
+
+// Live updates: binary WebSocket (bin1 keyframe + deltas), SSE JSON if it cannot connect
+const rows=[0,1,2,3].map(()=>Array(20).fill(' '));
+let seq=-1, keyAsked=false, es=null;
+const chr=b=>(b<0x20||b>0x7e)?' ':String.fromCharCode(b);
+
+function onPacket(b, ws){
+  if(b.length<10||b[0]!==0xA7||b[1]!==0x4C||b[2]!==1) return;
+  const type=b[3], end=b.length-2;     // TCP: no need to check the CRC
+  const resync=()=>{ if(!keyAsked){ keyAsked=true; ws.send('key'); } };
+  if(type===1){
+    if(end-8!==80) return;
+    for(let r=0;r<4;r++) for(let c=0;c<20;c++) rows[r][c]=chr(b[8+r*20+c]);
+    keyAsked=false;
+  }else if(type===2){
+    if((b[8]|(b[9]<<8))!==seq) return resync();
+    const next=rows.map(r=>r.slice());
+    for(let i=10;i<end;){
+      const row=b[i]>>5, col=b[i]&31;
+      if(row>3||col===30) return resync();            // no row dictionary on this link
+      if(col===31){                                    // shift k cells, fill the edge
+        const k=(b[i+1]<<24)>>24, edge=Math.abs(k), first=k>0?20-edge:0, old=next[row].slice();
+        for(let c=0;c<20;c++){ const s=c+k; next[row][c]=(s>=0&&s<20)?old[s]:chr(b[i+2+c-first]); }
+        i+=2+edge;
+      }else{                                           // span
+        const n=b[i+1];
+        for(let k=0;k<n;k++) next[row][col+k]=chr(b[i+2+k]);
+        i+=2+n;
+      }
+    }
+    for(let r=0;r<4;r++) rows[r]=next[r];
+  }else return;
+  seq=b[4]|(b[5]<<8);
+  apply({rows:rows.map(r=>r.join('')), disp:!!(b[6]&1), cur:!!(b[6]&2), blink:!!(b[6]&4),
+         cursor:{r:(b[7]>>5)&3, c:b[7]&31}});
+}
+
+// SSE: full "message" frames and "delta" events against the frame we hold. The browser
+// resumes with Last-Event-ID on its own reconnects; a new EventSource starts from a full frame.
+let sseState=null;
+function startSse(){
+  if(es) return;
+  es = new EventSource('/emu/events');
+  es.addEventListener('message', e => {
+    try { sseState=JSON.parse(e.data); apply(sseState); } catch(_){}
+  });
+  es.addEventListener('delta', e => {
+    let d; try { d=JSON.parse(e.data); } catch(_){ return; }
+    if(!sseState || sseState.gen!==d.base){ es.close(); es=null; sseState=null; return startSse(); }
+    const next=sseState.rows.map(r=>r.padEnd(20,' ').split(''));
+    for(const [r,c,t] of d.cells) for(let k=0;k<t.length;k++) next[r][c+k]=t[k];
+    sseState=Object.assign({}, sseState, d, {rows:next.map(r=>r.join(''))});
+    apply(sseState);
+  });
+}
+
+function startWs(){
+  if(!('WebSocket' in window)) return startSse();
+  let opened=false;
+  const ws=new WebSocket((location.protocol==='https:'?'wss://':'ws://')+location.host+'/emu/ws');
+  ws.binaryType='arraybuffer';
+  ws.onopen=()=>{ opened=true; seq=-1; keyAsked=false; };
+  ws.onmessage=e=>{ if(typeof e.data!=='string') onPacket(new Uint8Array(e.data), ws); };
+  // Never opened (blocked, proxy, old firmware): SSE. Dropped later: reconnect.
+  ws.onclose=()=>{ if(opened) setTimeout(startWs,1500); else startSse(); };
+}
+startWs();
+
+// If no data after 10s, show message (already visible by default)
+setTimeout(()=>{ if(!haveData) msg.style.display='block'; },10000);
@@ -0,0 +1,488 @@
+// web_assets_data.h
+//
+// GENERATED by script/build_web_assets.py from src/Transmitter/web/ - do not edit.
+// Edit the files in web/ and rerun the script.
+
+#pragma once
+
+#include <Arduino.h>
+
+#include "web_assets.h"
+
+namespace WebAssets {
+
+// emu.css: 1392 -> 725 bytes
+static const uint8_t k_emu_css[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xa5, 0x54, 0xc1, 0x6e, 0xdb, 0x30,
+    0x0c, 0xbd, 0xf7, 0x2b, 0x04, 0x18, 0x03, 0x62, 0xc0, 0xce, 0xe4, 0xb4, 0x49, 0x13, 0xf9, 0xb2,
+    0x61, 0xc0, 0xb0, 0x1d, 0x7a, 0x69, 0xb1, 0x0f, 0xa0, 0x2d, 0xda, 0x11, 0x2a, 0x4b, 0x86, 0x2c,
+    0x37, 0xc9, 0x82, 0xfc, 0xfb, 0x28, 0x3b, 0xc9, 0xdc, 0x74, 0xb7, 0x41, 0x80, 0x60, 0x4a, 0x22,
+    0xf9, 0xf8, 0x1e, 0x69, 0xe1, 0xac, 0xf5, 0xc7, 0x34, 0x2d, 0x6a, 0x11, 0xf1, 0x22, 0xac, 0x3c,
+    0x4d, 0x5b, 0x30, 0xa8, 0x45, 0x94, 0x2d, 0xc3, 0x22, 0xdb, 0xe3, 0xde, 0x8b, 0x08, 0x37, 0x61,
+    0x91, 0xd9, 0xf4, 0x1e, 0xa5, 0x88, 0x36, 0x00, 0x1c, 0x56, 0x64, 0xd7, 0x4e, 0x91, 0xb9, 0x58,
+    0x2c, 0xf2, 0xd3, 0x5d, 0x61, 0xe5, 0xe1, 0xd8, 0x80, 0xab, 0x95, 0x11, 0x3c, 0x2f, 0xa0, 0x7c,
+    0xad, 0x9d, 0xed, 0x8d, 0x14, 0x6f, 0xe0, 0x66, 0x21, 0x4d, 0x9c, 0x97, 0x56, 0x5b, 0x77, 0xb6,
+    0x43, 0xe4, 0x38, 0xaf, 0xac, 0xf1, 0x22, 0x7b, 0x68, 0xf7, 0x9f, 0xb3, 0xf9, 0x03, 0xeb, 0x55,
+    0xda, 0x58, 0x63, 0xbb, 0x16, 0x4a, 0x4c, 0xd8, 0xcb, 0xf7, 0x27, 0x32, 0xd2, 0x67, 0xac, 0x7b,
+    0x0d, 0x2e, 0x61, 0x4f, 0x68, 0xb4, 0x4d, 0xd8, 0x37, 0x6b, 0x3a, 0xab, 0xa1, 0x4b, 0xd8, 0xf5,
+    0x2d, 0x65, 0x9f, 0xef, 0x1c, 0xb4, 0x94, 0x7e, 0x9f, 0xee, 0x94, 0xf4, 0x5b, 0xb1, 0x5e, 0xf3,
+    0x76, 0x9f, 0x9f, 0xe1, 0x2c, 0x28, 0x01, 0x83, 0xde, 0xdb, 0xbc, 0x05, 0x29, 0x95, 0xa9, 0x05,
+    0x67, 0xd9, 0x8a, 0xee, 0xc9, 0xaf, 0x04, 0x27, 0x8f, 0x1f, 0xd0, 0x0e, 0x3c, 0xc4, 0x79, 0x61,
+    0x9d, 0x44, 0x97, 0x3a, 0x90, 0xaa, 0xef, 0x06, 0x9c, 0x74, 0xb4, 0x4f, 0xbb, 0x2d, 0x48, 0xbb,
+    0xa3, 0x20, 0x6b, 0x8a, 0x3b, 0x04, 0x77, 0x75, 0x01, 0x33, 0x9e, 0x84, 0x35, 0xbf, 0x5f, 0xc6,
+    0xd7, 0x3c, 0x21, 0x0b, 0x1b, 0xb7, 0xf5, 0x90, 0x6f, 0x9b, 0x5d, 0x39, 0x62, 0x04, 0x62, 0x41,
+    0x87, 0x03, 0x07, 0x2b, 0xce, 0x87, 0x27, 0xac, 0x3b, 0x74, 0x1e, 0x9b, 0xb4, 0x57, 0xc9, 0x0b,
+    0xd6, 0x16, 0xd9, 0xaf, 0x9f, 0xc9, 0xb3, 0x2d, 0xac, 0xb7, 0xc9, 0x0f, 0xd4, 0x6f, 0xe8, 0x55,
+    0x09, 0xc9, 0x57, 0xa7, 0x40, 0x07, 0xf0, 0xba, 0x94, 0x47, 0xa9, 0xba, 0x56, 0xc3, 0x41, 0x04,
+    0x2d, 0xf2, 0xb0, 0x11, 0xb5, 0x0d, 0x9d, 0x78, 0x4c, 0x89, 0xef, 0xbe, 0x31, 0x9d, 0x70, 0xd8,
+    0x22, 0xf8, 0xd9, 0x82, 0x27, 0x59, 0xe5, 0xe2, 0xbc, 0x86, 0x56, 0x0c, 0xa5, 0xdc, 0x56, 0x1d,
+    0xbc, 0x27, 0xd8, 0xf9, 0x50, 0xee, 0x3b, 0x06, 0xf8, 0x48, 0x9a, 0xb3, 0xbb, 0xff, 0xc8, 0x3b,
+    0x12, 0x90, 0x52, 0x51, 0xde, 0x36, 0xe1, 0x24, 0xc8, 0x80, 0x5a, 0x4f, 0x65, 0x88, 0x78, 0x95,
+    0x3d, 0x2e, 0xe0, 0x26, 0x7f, 0xd0, 0xec, 0x02, 0x2f, 0x90, 0x3a, 0x44, 0xa3, 0x50, 0xa3, 0xe6,
+    0x03, 0xba, 0xd0, 0x57, 0x29, 0x68, 0x55, 0x1b, 0x51, 0xa2, 0xf1, 0xe8, 0xf2, 0xdd, 0x56, 0x11,
+    0xa6, 0xa1, 0x51, 0x44, 0xeb, 0xf0, 0xdc, 0x85, 0x51, 0x59, 0xc8, 0x25, 0x66, 0xa7, 0xbb, 0x28,
+    0x90, 0x58, 0x92, 0x06, 0x40, 0xa2, 0x50, 0x41, 0xb6, 0xf7, 0xac, 0xa5, 0x6f, 0x7f, 0x46, 0x35,
+    0x2f, 0x7b, 0x77, 0x9c, 0xa8, 0xae, 0x4c, 0x87, 0x9e, 0xb4, 0x4b, 0xef, 0x09, 0x00, 0x67, 0xd7,
+    0x38, 0xe3, 0xe3, 0x42, 0xbf, 0x1e, 0xc1, 0xa8, 0x06, 0xbc, 0xb2, 0x46, 0x90, 0xc5, 0xb2, 0x8e,
+    0x91, 0xa2, 0x6d, 0x37, 0xcb, 0x62, 0xa6, 0x4c, 0xa5, 0x0c, 0xa1, 0x39, 0xdd, 0x7d, 0x79, 0xc5,
+    0x43, 0xe5, 0xa0, 0xc1, 0x8e, 0x05, 0x97, 0x25, 0xff, 0xf4, 0xae, 0xfa, 0x31, 0xe8, 0x05, 0xea,
+    0xc8, 0xc5, 0x69, 0xc4, 0x3a, 0xb7, 0x55, 0xc5, 0x46, 0xbe, 0xc6, 0x6b, 0xef, 0xc0, 0x50, 0x75,
+    0x8e, 0xaa, 0x9d, 0x76, 0xa7, 0xb1, 0x06, 0xf3, 0xbf, 0x50, 0x82, 0x49, 0x20, 0x1b, 0xf4, 0x70,
+    0x95, 0xae, 0xd2, 0xb8, 0x1f, 0x54, 0x19, 0x86, 0x61, 0x3a, 0x9d, 0xc3, 0xa0, 0xc7, 0x97, 0xf9,
+    0x09, 0xc4, 0x52, 0xa9, 0x3c, 0x0f, 0x0e, 0x69, 0x98, 0x34, 0x11, 0x36, 0x0a, 0xd7, 0xaa, 0x1b,
+    0xd9, 0xb2, 0x2c, 0x3b, 0x6b, 0x26, 0xb2, 0xd0, 0xcd, 0x56, 0x2b, 0xc9, 0xa2, 0x05, 0x84, 0x75,
+    0x23, 0xe6, 0x66, 0xb3, 0x99, 0xc8, 0x49, 0x93, 0x10, 0xc6, 0x89, 0x62, 0x16, 0xe0, 0x8e, 0x5b,
+    0x54, 0xf5, 0xd6, 0x8f, 0x5d, 0xfa, 0x0f, 0xa7, 0x49, 0x46, 0xad, 0x0c, 0x82, 0xa3, 0xd6, 0xa5,
+    0x7b, 0x62, 0x60, 0xb6, 0xe1, 0x12, 0xeb, 0x84, 0xfe, 0x49, 0xe5, 0x72, 0x89, 0x49, 0xc4, 0x57,
+    0xc5, 0x4a, 0x3e, 0xc4, 0xb9, 0x25, 0xf9, 0x95, 0x3f, 0x88, 0xf9, 0xea, 0x52, 0x54, 0x18, 0x36,
+    0x4e, 0xe9, 0x8c, 0x95, 0x40, 0x9c, 0x7c, 0xec, 0x9b, 0x33, 0xf9, 0x45, 0x51, 0x0c, 0x23, 0x9a,
+    0x76, 0xea, 0x37, 0x8a, 0x0c, 0x9b, 0x77, 0x7f, 0x15, 0x4e, 0xe3, 0x00, 0x67, 0x21, 0xa2, 0x47,
+    0x29, 0xef, 0xab, 0x72, 0x6c, 0x41, 0x89, 0xa5, 0x75, 0x53, 0xea, 0xff, 0x00, 0xbd, 0x1a, 0x50,
+    0x64, 0x70, 0x05, 0x00, 0x00,
+};
+
+// emu.js: 5492 -> 2443 bytes
+static const uint8_t k_emu_js[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x8d, 0x58, 0x5d, 0x6f, 0xdb, 0x38,
+    0x16, 0x7d, 0xf7, 0xaf, 0x60, 0xf2, 0x10, 0x49, 0x6b, 0x45, 0x91, 0xdd, 0x74, 0xdb, 0xb5, 0x23,
+    0x07, 0x9d, 0xb4, 0x0b, 0x74, 0xd1, 0xed, 0x0c, 0x36, 0x1d, 0xcc, 0x83, 0x61, 0x2c, 0x64, 0x89,
+    0xb6, 0x15, 0xcb, 0x94, 0x87, 0xa4, 0xe3, 0x18, 0xb1, 0xff, 0xfb, 0x9e, 0x4b, 0x52, 0xb2, 0x9c,
+    0xa6, 0xdd, 0x09, 0x10, 0x59, 0x24, 0x2f, 0x2f, 0xef, 0xf7, 0x3d, 0x54, 0x56, 0x09, 0xa5, 0x59,
+    0x99, 0xe5, 0x49, 0x5e, 0x65, 0x9b, 0x15, 0x17, 0x3a, 0x9a, 0x73, 0xfd, 0xa9, 0xe4, 0xf4, 0xfa,
+    0xcb, 0xee, 0x73, 0xee, 0x7b, 0x58, 0xf4, 0x82, 0x61, 0x27, 0x33, 0x94, 0x2b, 0x35, 0xff, 0x31,
+    0xa5, 0xa8, 0xf2, 0x54, 0xa7, 0x2d, 0xe2, 0xbc, 0x50, 0xeb, 0x1f, 0x93, 0x9b, 0xe5, 0x16, 0x75,
+    0xb6, 0x91, 0x3f, 0x21, 0xc6, 0x6a, 0x8b, 0x76, 0x5a, 0x16, 0x62, 0xf9, 0x13, 0x6a, 0xb3, 0xde,
+    0xa2, 0x5f, 0x57, 0xea, 0x27, 0xd4, 0x58, 0x25, 0xda, 0x92, 0x6b, 0xb6, 0x48, 0x1f, 0xf9, 0x47,
+    0x68, 0x91, 0xcc, 0xd2, 0x52, 0xf1, 0x61, 0xa7, 0x73, 0x75, 0xc5, 0xbe, 0x2d, 0x38, 0x7b, 0x1f,
+    0xb3, 0x8c, 0x97, 0xa5, 0x62, 0xa9, 0xe4, 0x6c, 0xba, 0x29, 0x4a, 0xcd, 0x2a, 0x91, 0xf1, 0x21,
+    0x4b, 0xd9, 0x4c, 0xa6, 0x2b, 0x8e, 0x51, 0xb9, 0x63, 0x92, 0x6f, 0x65, 0xa1, 0xb9, 0x62, 0x1a,
+    0x5b, 0x2c, 0xfd, 0x76, 0x51, 0x29, 0xbc, 0x2f, 0x52, 0x99, 0x66, 0x9a, 0x4b, 0x7a, 0x13, 0x73,
+    0x9e, 0x47, 0xc4, 0xf8, 0xf7, 0x35, 0x0c, 0xc6, 0x2d, 0xcf, 0xac, 0x4a, 0x4b, 0xae, 0x32, 0x9e,
+    0x33, 0x5d, 0x81, 0x19, 0x67, 0xb9, 0x4c, 0xb7, 0x6c, 0x8d, 0x1d, 0xa9, 0x28, 0x56, 0xa9, 0x2e,
+    0x2a, 0xe1, 0x4e, 0xf2, 0x4b, 0xda, 0xa4, 0x99, 0xd2, 0xf8, 0x65, 0xdb, 0x42, 0xa8, 0x20, 0x64,
+    0xaa, 0x62, 0x29, 0xb1, 0x5c, 0xa5, 0xf2, 0xcf, 0x0d, 0x27, 0x76, 0x4a, 0x2b, 0x12, 0x8e, 0x6f,
+    0x99, 0xe6, 0x4f, 0x9a, 0xc1, 0x39, 0x38, 0x89, 0xf8, 0x59, 0x2e, 0xa9, 0xc8, 0x31, 0xc7, 0xca,
+    0x74, 0x57, 0x6d, 0xa0, 0xcb, 0xcc, 0x88, 0x3c, 0x97, 0x05, 0x24, 0xb3, 0x36, 0x33, 0xe2, 0x27,
+    0xe3, 0x09, 0x78, 0x2f, 0xaa, 0xad, 0xc0, 0xdb, 0xb0, 0x33, 0xab, 0xa4, 0x4f, 0x56, 0x92, 0x49,
+    0x3c, 0x94, 0x37, 0xd7, 0x43, 0xd9, 0xed, 0x06, 0xcf, 0x1d, 0xc6, 0xec, 0x0e, 0x59, 0x6d, 0x8f,
+    0x46, 0xce, 0x24, 0x87, 0x78, 0xce, 0xce, 0xbe, 0x97, 0x17, 0x8f, 0x30, 0x31, 0x91, 0x44, 0x59,
+    0x99, 0x2a, 0xf5, 0x15, 0x32, 0x24, 0x1e, 0x86, 0xde, 0x10, 0xfb, 0x6b, 0xbe, 0x19, 0xf8, 0x66,
+    0x37, 0x7d, 0x3c, 0x1c, 0xe3, 0x9a, 0x75, 0xfe, 0xff, 0x18, 0xe7, 0x6d, 0xb6, 0x24, 0xba, 0xe1,
+    0xcb, 0x30, 0x4f, 0xda, 0xdf, 0x55, 0x42, 0x83, 0x3a, 0xf1, 0x98, 0x9b, 0x26, 0x39, 0xd2, 0xf5,
+    0x9a, 0x8b, 0xfc, 0x6e, 0x51, 0x94, 0xb9, 0x9f, 0x07, 0x76, 0xde, 0x28, 0x1d, 0xad, 0x37, 0x6a,
+    0x41, 0x53, 0x56, 0x73, 0x3b, 0xc4, 0x56, 0x43, 0x73, 0xc0, 0x3f, 0x52, 0xe2, 0x64, 0x37, 0xb8,
+    0x61, 0xed, 0x60, 0x02, 0x88, 0x66, 0x0b, 0x31, 0x4f, 0xc4, 0xa6, 0x2c, 0x43, 0x06, 0x5f, 0x6c,
+    0x78, 0x6e, 0x83, 0x29, 0x64, 0x88, 0xe1, 0xcf, 0xf9, 0x53, 0x72, 0xd9, 0x33, 0xaf, 0x77, 0x30,
+    0xaf, 0xe7, 0x85, 0x6c, 0xc5, 0x11, 0x6e, 0x1e, 0x04, 0xeb, 0xcc, 0x36, 0x22, 0x33, 0x8e, 0x26,
+    0xdf, 0xfb, 0xc6, 0x00, 0x6d, 0x06, 0xc3, 0xc6, 0xd2, 0x2a, 0x71, 0xc7, 0x0c, 0x4f, 0xce, 0x23,
+    0x82, 0x62, 0xe6, 0x9f, 0xa9, 0x00, 0x91, 0xa8, 0x37, 0x52, 0x0c, 0xdb, 0xbe, 0x51, 0x89, 0x8a,
+    0xe8, 0x67, 0xbf, 0x27, 0x57, 0x1e, 0x8d, 0xfe, 0xd2, 0x99, 0xf5, 0x16, 0xfd, 0xa4, 0x13, 0xa2,
+    0x1f, 0xcb, 0xc9, 0x7e, 0xef, 0x39, 0xc3, 0xfd, 0xc4, 0x53, 0xf5, 0xbe, 0x22, 0x91, 0x7f, 0xeb,
+    0xc7, 0xdd, 0x0c, 0x4a, 0x2e, 0x12, 0x30, 0x19, 0x67, 0xb4, 0xbf, 0xb6, 0xbc, 0x91, 0xd0, 0xd8,
+    0x75, 0x5c, 0x4c, 0xce, 0x92, 0x24, 0x5b, 0x04, 0xcf, 0xac, 0x1e, 0x63, 0x34, 0xb4, 0x3e, 0xc0,
+    0xe0, 0xc4, 0x73, 0xb4, 0x70, 0x30, 0x0c, 0x0e, 0x2d, 0x27, 0x18, 0x9f, 0x7f, 0x29, 0x94, 0x8e,
+    0x74, 0x35, 0x9f, 0x97, 0xdc, 0xf7, 0xaa, 0xd9, 0x0c, 0x26, 0x3d, 0x53, 0x11, 0x15, 0x17, 0x38,
+    0x05, 0x84, 0xc8, 0x8a, 0xbb, 0x8d, 0x54, 0x95, 0x1c, 0xb0, 0x8d, 0xc8, 0xb9, 0x44, 0x69, 0x30,
+    0xe1, 0x7f, 0x55, 0x49, 0x66, 0xea, 0x04, 0xcc, 0x87, 0x97, 0x2a, 0x5b, 0x22, 0xef, 0x58, 0x81,
+    0xb4, 0x21, 0x09, 0x1a, 0xcb, 0xad, 0x61, 0xb6, 0xcc, 0xec, 0x0f, 0x59, 0xb5, 0x4c, 0xd6, 0xec,
+    0xe2, 0x82, 0xe9, 0xdd, 0x9a, 0x23, 0x65, 0xd6, 0x91, 0x4c, 0x92, 0xc4, 0x13, 0x9b, 0xd5, 0x94,
+    0x4b, 0xef, 0x64, 0x21, 0x7b, 0xb1, 0x00, 0xd2, 0x9b, 0x6b, 0xfb, 0x62, 0xcc, 0xd6, 0xb0, 0x2f,
+    0x10, 0x10, 0xd5, 0x92, 0x56, 0x7c, 0x73, 0xce, 0x7e, 0xaf, 0x22, 0x23, 0x55, 0xc0, 0x6e, 0x69,
+    0x17, 0x99, 0x12, 0x7b, 0xd8, 0x80, 0x5d, 0xf6, 0x8e, 0xbb, 0x32, 0xc4, 0x8e, 0xa5, 0xbf, 0xf5,
+    0xf0, 0x60, 0xde, 0xc0, 0xf3, 0x82, 0xae, 0xef, 0xb6, 0xde, 0x7a, 0xd3, 0x72, 0x69, 0xa6, 0x5c,
+    0x44, 0xe0, 0x10, 0x32, 0xb5, 0x09, 0x3f, 0xb6, 0xdf, 0xd3, 0x76, 0x3b, 0x46, 0x0c, 0x3a, 0xef,
+    0x81, 0xca, 0xae, 0x8f, 0x92, 0x38, 0x70, 0x3e, 0xb0, 0x13, 0x93, 0x96, 0x99, 0x25, 0x5f, 0x55,
+    0x8f, 0x30, 0x33, 0x55, 0xe3, 0xd0, 0x9c, 0xe2, 0x12, 0xc7, 0x1e, 0x42, 0x7b, 0x9f, 0x8d, 0x83,
+    0x49, 0xb4, 0x9a, 0x4d, 0x71, 0xca, 0x23, 0xcd, 0x73, 0xcb, 0x00, 0x09, 0x66, 0x48, 0x9d, 0xba,
+    0x3f, 0x26, 0xb6, 0xe7, 0x38, 0xff, 0xbb, 0x24, 0x02, 0xdd, 0xb0, 0xce, 0x22, 0xa8, 0x63, 0x53,
+    0xb3, 0xb1, 0xcf, 0x2a, 0x19, 0xdb, 0x10, 0x08, 0x8d, 0x24, 0xa1, 0x3b, 0x24, 0xac, 0x96, 0xb7,
+    0xb0, 0x69, 0x17, 0xb2, 0x93, 0x51, 0x61, 0xa1, 0x49, 0xf4, 0x50, 0x15, 0xc2, 0xf7, 0xf6, 0x8d,
+    0xad, 0x56, 0xb0, 0x0c, 0xa5, 0xa4, 0xb3, 0x8b, 0xc9, 0xce, 0x95, 0x55, 0xd2, 0x74, 0xac, 0x76,
+    0x58, 0xb2, 0x84, 0xd9, 0x63, 0xe0, 0x2b, 0xaf, 0x12, 0x1e, 0xbc, 0x64, 0x22, 0xd0, 0x91, 0xe3,
+    0xe4, 0x13, 0x6a, 0x43, 0x4e, 0xee, 0x7a, 0x95, 0xda, 0x48, 0x78, 0x12, 0xf4, 0xcc, 0x89, 0xfd,
+    0x2a, 0x3d, 0x44, 0xad, 0x60, 0x35, 0x6a, 0x5e, 0x2f, 0x44, 0x82, 0x86, 0xac, 0xcb, 0xa0, 0x23,
+    0x9e, 0xd0, 0xd2, 0x9a, 0xe6, 0xd0, 0x2a, 0x2f, 0xa8, 0x5d, 0xe5, 0xce, 0x37, 0xfd, 0xc3, 0x68,
+    0x69, 0x6a, 0x86, 0x19, 0xb5, 0xea, 0x06, 0x4d, 0xd6, 0xdd, 0x10, 0x4e, 0x6d, 0x1a, 0xa3, 0x96,
+    0x1b, 0xb4, 0x3d, 0x00, 0x81, 0x48, 0xe9, 0x5d, 0xc9, 0x8d, 0xfa, 0xe8, 0x22, 0x88, 0x76, 0x74,
+    0x2d, 0xcf, 0x7a, 0xa9, 0x2e, 0x4a, 0x86, 0x69, 0xcd, 0xcc, 0x96, 0x32, 0xb0, 0x72, 0x35, 0xcd,
+    0x32, 0x92, 0x1c, 0x43, 0xa5, 0x3f, 0xd4, 0x4d, 0xee, 0x9f, 0xd4, 0x9d, 0x7c, 0x2a, 0x80, 0xc6,
+    0xe3, 0x07, 0xd3, 0x81, 0x3f, 0x8b, 0x42, 0x17, 0x69, 0x89, 0x6e, 0xa6, 0xb3, 0x45, 0xc7, 0x3c,
+    0x7d, 0xef, 0x8a, 0xaf, 0x36, 0x57, 0xe6, 0x04, 0x2f, 0x7c, 0xce, 0xd2, 0x6c, 0xc1, 0x07, 0x90,
+    0xe1, 0x52, 0xe9, 0x4a, 0x72, 0xef, 0x10, 0x44, 0x68, 0x68, 0xc2, 0x97, 0xc9, 0x48, 0x46, 0x0f,
+    0xaa, 0x12, 0x7e, 0xe0, 0x66, 0x1e, 0x92, 0x91, 0xd3, 0xf9, 0x81, 0xb2, 0xee, 0xc1, 0xd4, 0xc4,
+    0xe3, 0x5b, 0x54, 0x72, 0x31, 0xd7, 0x8b, 0x51, 0xdc, 0x9a, 0x52, 0x15, 0x44, 0xa2, 0xb2, 0x91,
+    0x8c, 0xe8, 0x19, 0x69, 0x59, 0xac, 0xfc, 0x00, 0x71, 0x72, 0x7e, 0x1e, 0x04, 0xce, 0x9a, 0x0f,
+    0xd4, 0x01, 0x82, 0x28, 0x4b, 0x49, 0x36, 0x3f, 0xc0, 0x21, 0x87, 0xc0, 0xc2, 0x87, 0x2f, 0xc5,
+    0x23, 0x67, 0x1b, 0xdb, 0xea, 0x07, 0x6c, 0x5a, 0x88, 0x54, 0xee, 0xd8, 0x1f, 0x7c, 0x7a, 0x8f,
+    0x8a, 0x83, 0x4a, 0xea, 0x63, 0xa6, 0xc7, 0x96, 0x7c, 0x67, 0xfb, 0x72, 0x97, 0xe5, 0xbc, 0xd4,
+    0x29, 0xf5, 0xf4, 0xfb, 0xfb, 0x4f, 0xec, 0x5f, 0xf7, 0xbf, 0x7e, 0x85, 0xac, 0x28, 0x4b, 0x2c,
+    0x4b, 0x85, 0xa8, 0x34, 0x05, 0xb8, 0xe0, 0x99, 0xee, 0xb4, 0xea, 0xfa, 0x38, 0x0e, 0x7b, 0x61,
+    0x3f, 0x7c, 0x33, 0x89, 0x56, 0xe9, 0xda, 0x1c, 0xfe, 0x41, 0xca, 0x74, 0xe7, 0xf7, 0xe3, 0x20,
+    0x9a, 0x15, 0x65, 0x69, 0x9a, 0x97, 0x03, 0x38, 0x8a, 0xff, 0x69, 0x1a, 0x10, 0x0e, 0xfc, 0xa0,
+    0x96, 0xc7, 0xde, 0xc4, 0x95, 0x6b, 0x21, 0xae, 0xc0, 0x2c, 0x64, 0x32, 0x4d, 0x46, 0xfe, 0xf4,
+    0x26, 0x7e, 0xea, 0xc7, 0xfb, 0xfd, 0x74, 0x14, 0x3f, 0xbd, 0xe3, 0xc1, 0x2d, 0x38, 0x0d, 0xee,
+    0xa1, 0xbf, 0x98, 0x47, 0x33, 0x59, 0xad, 0xee, 0x80, 0x6b, 0xee, 0x80, 0x2c, 0xfc, 0x69, 0xd0,
+    0xee, 0x5f, 0x95, 0xf8, 0x2d, 0x25, 0xe5, 0xfc, 0x69, 0xc8, 0xb6, 0xaa, 0x8e, 0xb1, 0xa9, 0xb3,
+    0xed, 0x4d, 0x8f, 0x18, 0x8e, 0x63, 0x2a, 0xff, 0xf1, 0xd3, 0x87, 0x77, 0x34, 0xe8, 0xd9, 0xc1,
+    0xf5, 0x1d, 0x0d, 0xfa, 0x34, 0xe8, 0x7d, 0xdf, 0xc4, 0xa8, 0xba, 0x26, 0xd3, 0xf1, 0x1b, 0x60,
+    0x12, 0x04, 0x58, 0x52, 0xf3, 0xbb, 0xec, 0x0f, 0x4d, 0x63, 0x21, 0xa8, 0x76, 0xf7, 0xdb, 0x80,
+    0x60, 0x8d, 0xe0, 0x16, 0x48, 0x21, 0x28, 0x50, 0xd6, 0x09, 0xda, 0xdc, 0xfd, 0xe7, 0xee, 0xd8,
+    0x0c, 0xb9, 0xda, 0x89, 0x2c, 0x31, 0x5e, 0x32, 0xa1, 0x59, 0x1b, 0x03, 0xc1, 0xd9, 0xd8, 0xc5,
+    0x86, 0x27, 0x79, 0x1f, 0x67, 0xf9, 0x1e, 0xe6, 0x4d, 0x0d, 0x62, 0x07, 0x17, 0xcf, 0x46, 0x18,
+    0x12, 0xb3, 0xa9, 0x9f, 0xa0, 0xbb, 0x7c, 0x0f, 0xc9, 0xdf, 0xc7, 0x6d, 0xd1, 0x5f, 0x6f, 0xb4,
+    0xaf, 0x37, 0x52, 0xe6, 0xfa, 0x2d, 0x5a, 0x26, 0x3a, 0x9e, 0xf4, 0xa7, 0xe3, 0xf7, 0x5d, 0xdb,
+    0x4c, 0x27, 0xae, 0xce, 0x9e, 0xba, 0xcd, 0xa4, 0x36, 0xc7, 0x4b, 0x4b, 0xa0, 0xfe, 0x51, 0x20,
+    0xda, 0x3f, 0xd9, 0xe3, 0xf9, 0x8f, 0xc9, 0xcd, 0xcd, 0xfb, 0x80, 0x22, 0x16, 0xee, 0xaf, 0x85,
+    0x73, 0x66, 0xf0, 0x6b, 0xe8, 0x63, 0x4c, 0x23, 0xb8, 0xeb, 0xfa, 0x26, 0x94, 0x4c, 0xf6, 0xa8,
+    0xb2, 0xc8, 0xb8, 0x1f, 0x04, 0xa7, 0xca, 0x14, 0x49, 0x2f, 0x1e, 0x16, 0x37, 0xd0, 0x79, 0xf8,
+    0xa2, 0xff, 0x13, 0x0c, 0x9c, 0xa2, 0x7f, 0x8f, 0x46, 0x6f, 0x01, 0x01, 0xaa, 0xd2, 0x0c, 0x2e,
+    0xde, 0xf4, 0x5a, 0xfd, 0x1f, 0x24, 0xa3, 0x37, 0xfb, 0x3d, 0x2d, 0x26, 0xc9, 0x9b, 0xf8, 0x7b,
+    0x89, 0x58, 0xeb, 0x0f, 0x6e, 0x85, 0x47, 0xb1, 0x85, 0xe5, 0x85, 0x09, 0x2f, 0xca, 0x1f, 0x04,
+    0x99, 0x5e, 0x14, 0x8a, 0x51, 0x79, 0x3c, 0xf2, 0x75, 0x0c, 0xe1, 0x13, 0xf6, 0x17, 0xfe, 0xc0,
+    0x58, 0x2d, 0x8a, 0x99, 0x66, 0x4b, 0xdb, 0x7b, 0x42, 0x46, 0xc9, 0x62, 0xa2, 0x85, 0xe7, 0x73,
+    0xde, 0xa9, 0xe9, 0xac, 0x5a, 0xcb, 0x04, 0x86, 0x2c, 0xba, 0x3d, 0x98, 0xb2, 0x7f, 0x1d, 0x8c,
+    0x46, 0xfd, 0xeb, 0xd0, 0x90, 0x25, 0xff, 0x4e, 0xf5, 0x22, 0x4a, 0xa7, 0xca, 0x5f, 0x06, 0xc4,
+    0x41, 0x2a, 0x9d, 0x2c, 0x47, 0xf1, 0x6d, 0x3f, 0xbe, 0xa4, 0xe5, 0x41, 0x0c, 0xd8, 0x50, 0xe6,
+    0x09, 0x19, 0x76, 0x0c, 0x25, 0x26, 0xb5, 0x3d, 0x87, 0x0d, 0xff, 0xd7, 0x31, 0x55, 0x03, 0xf5,
+    0xb2, 0xee, 0x72, 0xc8, 0x9a, 0xed, 0x14, 0x1a, 0xbe, 0x42, 0xa3, 0xbd, 0xb8, 0x50, 0xa0, 0x0d,
+    0x6e, 0xc1, 0x7c, 0xac, 0x26, 0x03, 0x1b, 0x2e, 0x45, 0xb7, 0xdf, 0xcd, 0x2e, 0x8d, 0x10, 0x93,
+    0xa6, 0x63, 0x1a, 0xe3, 0x74, 0x93, 0x7e, 0x97, 0xe4, 0xa9, 0x8f, 0x35, 0x61, 0xf3, 0x97, 0xcc,
+    0xd4, 0xb2, 0xd6, 0x3a, 0x15, 0x2f, 0xac, 0x22, 0x12, 0x6b, 0x94, 0xef, 0xb5, 0x59, 0x42, 0x9b,
+    0xe5, 0x8d, 0x18, 0x2e, 0x29, 0xae, 0x5b, 0xe2, 0x57, 0x65, 0x77, 0x59, 0x47, 0x37, 0x89, 0xbb,
+    0x9c, 0xb4, 0x4c, 0x61, 0xc4, 0x14, 0x8d, 0x8c, 0x9d, 0xe3, 0xf3, 0xd5, 0x24, 0x72, 0xe9, 0xe2,
+    0x8c, 0x3b, 0x39, 0xa6, 0xc3, 0x31, 0xfd, 0xa8, 0xde, 0x4d, 0xc7, 0xd7, 0x26, 0x0d, 0xde, 0x9a,
+    0x34, 0xa0, 0x59, 0x5b, 0xb3, 0x9f, 0x69, 0xff, 0xe0, 0x34, 0xda, 0x2d, 0x1c, 0x40, 0xb9, 0x0c,
+    0x19, 0x75, 0xb6, 0xc1, 0xd9, 0x19, 0x36, 0xfe, 0x7d, 0x72, 0xd1, 0x0b, 0x0c, 0x68, 0x6f, 0xc6,
+    0x7d, 0x8c, 0x4d, 0x73, 0x6e, 0x66, 0xae, 0x83, 0xb0, 0xd1, 0x83, 0x59, 0xc4, 0x38, 0x78, 0x96,
+    0x03, 0x2c, 0xbe, 0xa3, 0x5c, 0x08, 0x2e, 0xde, 0x80, 0xc3, 0x80, 0x46, 0x48, 0x86, 0xc3, 0xc1,
+    0xdc, 0x18, 0xa8, 0x3f, 0xa0, 0xcc, 0x0f, 0xd8, 0x0c, 0xb5, 0x97, 0x9d, 0xaf, 0xb8, 0x52, 0xe9,
+    0x9c, 0x9f, 0xdb, 0x3b, 0x9a, 0x32, 0x97, 0xb4, 0x73, 0xd3, 0x0f, 0xce, 0x19, 0x7f, 0x44, 0x77,
+    0xc7, 0xd4, 0x3c, 0x2d, 0x4c, 0x2d, 0x44, 0x94, 0xda, 0x8e, 0xb1, 0xe5, 0x6c, 0x81, 0x20, 0x88,
+    0xcc, 0x3d, 0x75, 0x4a, 0xda, 0x70, 0x49, 0x7c, 0x91, 0x4c, 0x1b, 0x62, 0xb2, 0x2d, 0xf4, 0x82,
+    0x7d, 0x49, 0x95, 0xbe, 0xfc, 0x44, 0x2c, 0x2e, 0x3f, 0x7f, 0xac, 0x71, 0x2e, 0x40, 0x37, 0xa8,
+    0x5c, 0x43, 0x51, 0x74, 0x97, 0x15, 0xb8, 0x2e, 0x1a, 0xaa, 0xfb, 0x6a, 0x23, 0x33, 0x4e, 0x77,
+    0x4c, 0x09, 0x42, 0x2a, 0xf5, 0x74, 0x99, 0x24, 0x21, 0xcd, 0xa1, 0x91, 0xed, 0x25, 0x8a, 0xdf,
+    0x53, 0xff, 0x75, 0x9d, 0xa3, 0x29, 0xff, 0x66, 0xd7, 0xbd, 0xe2, 0x7e, 0x5d, 0xf9, 0xf9, 0xc9,
+    0x8d, 0x04, 0x32, 0x25, 0x2f, 0x4f, 0x72, 0xed, 0xdc, 0x2a, 0x69, 0xb1, 0x18, 0x57, 0x84, 0xfe,
+    0x0c, 0x0d, 0x41, 0x41, 0x2e, 0xb8, 0xc4, 0x5d, 0xdd, 0x5a, 0x08, 0x18, 0x9f, 0xb3, 0x64, 0xc4,
+    0x6c, 0xe5, 0xd1, 0x28, 0x08, 0xcf, 0x47, 0x69, 0xa8, 0x67, 0x46, 0xeb, 0x54, 0x42, 0x00, 0xc0,
+    0x13, 0x82, 0x2f, 0xc3, 0x1a, 0xf2, 0x38, 0x12, 0x53, 0xc8, 0x6d, 0xab, 0xfe, 0x6f, 0xf0, 0x6c,
+    0x6e, 0x14, 0x3f, 0x3e, 0xd2, 0xd8, 0xff, 0xf4, 0x40, 0x52, 0x3e, 0x1f, 0xba, 0x73, 0xf3, 0x57,
+    0x0f, 0x6c, 0xf1, 0xaf, 0x55, 0x77, 0x91, 0x6c, 0xd0, 0x96, 0x13, 0x84, 0xc0, 0x78, 0xfd, 0x1e,
+    0xcd, 0xb9, 0x40, 0x85, 0xce, 0xa3, 0x69, 0xaa, 0x80, 0xcb, 0x48, 0x98, 0xac, 0xac, 0xc8, 0x8a,
+    0xc3, 0xa6, 0x3b, 0xbf, 0x30, 0x79, 0x5d, 0x37, 0x8f, 0x06, 0x6f, 0x50, 0xf2, 0xb1, 0x9a, 0x37,
+    0xfc, 0x4f, 0x03, 0x7d, 0x9d, 0xe6, 0x9f, 0xd0, 0xd8, 0xfa, 0x71, 0x48, 0xe8, 0x20, 0x02, 0x88,
+    0x2b, 0xb4, 0x09, 0xfc, 0x63, 0x9d, 0xb7, 0x4c, 0xc6, 0x32, 0xcc, 0x42, 0x3d, 0xa1, 0x6f, 0x04,
+    0xb8, 0x71, 0x51, 0xa1, 0x0c, 0x5e, 0x24, 0xb9, 0x76, 0x8d, 0xb8, 0x9d, 0xeb, 0xc8, 0x74, 0xca,
+    0x73, 0x3d, 0x5e, 0xba, 0xda, 0xd0, 0x48, 0xfe, 0xeb, 0xf4, 0x01, 0xe1, 0x16, 0x01, 0xe1, 0x17,
+    0x73, 0xe1, 0x3f, 0x1f, 0xc2, 0x66, 0x09, 0x29, 0x17, 0x32, 0x9b, 0x94, 0xc4, 0xe4, 0x95, 0xa4,
+    0x3c, 0x38, 0xe9, 0x5e, 0xba, 0xd3, 0x79, 0xb0, 0x0d, 0x72, 0x8d, 0x4d, 0xfe, 0x50, 0x4d, 0x0c,
+    0x9e, 0xf9, 0x5e, 0x03, 0xba, 0x3c, 0x56, 0x08, 0xfa, 0x72, 0x92, 0xe3, 0xe2, 0x1e, 0xbc, 0x62,
+    0xc4, 0x8e, 0x75, 0x71, 0x05, 0x1c, 0xfb, 0xfd, 0xe5, 0x1b, 0x80, 0x8b, 0x82, 0xb7, 0x61, 0xe6,
+    0xfb, 0xb8, 0x3b, 0x1a, 0xec, 0x1a, 0xad, 0x65, 0xa5, 0x2b, 0xdb, 0x84, 0xbc, 0x85, 0xd6, 0x6b,
+    0x35, 0xf0, 0x6e, 0xbd, 0xad, 0x52, 0x83, 0xab, 0x2b, 0x5c, 0xc7, 0xb6, 0xe6, 0x37, 0xe8, 0x36,
+    0xe4, 0x8b, 0x4a, 0xe9, 0xae, 0x0d, 0xfc, 0xad, 0x0b, 0x7a, 0x78, 0xc8, 0x22, 0xc4, 0x6f, 0xd4,
+    0xcd, 0xbd, 0x94, 0x70, 0xdc, 0x74, 0x33, 0x9b, 0xe1, 0x1a, 0xe9, 0x96, 0x2b, 0x41, 0x62, 0x39,
+    0xf0, 0xe2, 0x24, 0xb4, 0x58, 0xc5, 0x42, 0xbb, 0xe1, 0x4b, 0x8c, 0x60, 0x11, 0x8b, 0xd9, 0xe9,
+    0xb2, 0x27, 0xe1, 0x0e, 0xf8, 0xb8, 0xeb, 0xaa, 0x0d, 0x5a, 0xc4, 0x9e, 0xa7, 0x0c, 0xb4, 0xf3,
+    0x82, 0x23, 0x82, 0x23, 0x55, 0x7f, 0x2f, 0x84, 0x7e, 0x6f, 0x21, 0xa5, 0x8b, 0x6f, 0x03, 0xeb,
+    0x1c, 0x67, 0x94, 0x9a, 0xaf, 0xc8, 0x5b, 0xe9, 0x84, 0x01, 0xa0, 0xa5, 0xbb, 0x34, 0x87, 0x2b,
+    0x61, 0x8e, 0xa7, 0x9d, 0x69, 0x7f, 0xd4, 0x17, 0x57, 0xdb, 0x54, 0xf2, 0x60, 0x40, 0xf5, 0x2e,
+    0x62, 0x1f, 0x65, 0xb5, 0x5e, 0x83, 0x98, 0xbe, 0x65, 0xe1, 0x62, 0xde, 0x54, 0xa1, 0xa8, 0x16,
+    0xd5, 0x84, 0xfe, 0x11, 0xa2, 0x59, 0xde, 0x01, 0x74, 0xd4, 0xdf, 0x8a, 0x15, 0xaf, 0x36, 0xda,
+    0x77, 0x0e, 0x0e, 0x7b, 0x6f, 0xe3, 0x98, 0x52, 0x84, 0xea, 0xfe, 0x49, 0x22, 0x50, 0x3c, 0x34,
+    0x51, 0x60, 0xb1, 0xf8, 0xe7, 0x19, 0x61, 0x09, 0x52, 0x81, 0xa5, 0x33, 0xfa, 0x1c, 0xd7, 0x8b,
+    0x95, 0xfd, 0xc0, 0xc5, 0x9c, 0x6d, 0x98, 0x9f, 0x96, 0x92, 0xa7, 0xf9, 0x8e, 0x3d, 0x16, 0xaa,
+    0x98, 0x96, 0x28, 0xa9, 0x3b, 0x40, 0xf2, 0x59, 0xba, 0x29, 0x75, 0xd0, 0x69, 0x1d, 0x7f, 0x44,
+    0x8f, 0xcd, 0x2d, 0xe9, 0xb5, 0x5b, 0x91, 0x31, 0x06, 0x5d, 0x8b, 0xc2, 0x5e, 0x1c, 0x93, 0xa0,
+    0x9d, 0xff, 0x01, 0xfd, 0x42, 0x14, 0x73, 0x74, 0x15, 0x00, 0x00,
+};
+
+// emu.html: 960 -> 438 bytes
+static const uint8_t k_emu_html[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x9d, 0x53, 0xc1, 0x6e, 0xd4, 0x30,
+    0x10, 0xbd, 0xef, 0x57, 0x0c, 0x3e, 0x77, 0x37, 0x1b, 0x10, 0x55, 0x85, 0x9c, 0xc0, 0x81, 0xde,
+    0x10, 0x5c, 0x90, 0xe0, 0x86, 0x26, 0xf6, 0x6c, 0x63, 0x70, 0x6c, 0xcb, 0x9e, 0x6c, 0xd9, 0x1b,
+    0x1f, 0xc1, 0x89, 0x13, 0xdf, 0xd6, 0x2f, 0xc1, 0xce, 0x26, 0xd0, 0x96, 0x55, 0x55, 0xb8, 0x24,
+    0x7e, 0xf3, 0x3c, 0x6f, 0x9e, 0x3d, 0x63, 0xf9, 0x44, 0x7b, 0xc5, 0x87, 0x40, 0xd0, 0xf3, 0x60,
+    0x5b, 0x39, 0x7f, 0x09, 0x75, 0xbb, 0x92, 0x03, 0x31, 0x82, 0xea, 0x31, 0x26, 0xe2, 0x46, 0x8c,
+    0xbc, 0x5b, 0x5f, 0x88, 0x6a, 0x89, 0x3b, 0x1c, 0xa8, 0x11, 0x7b, 0x43, 0xd7, 0xc1, 0x47, 0x16,
+    0xa0, 0xbc, 0x63, 0x72, 0x79, 0xdf, 0xb5, 0xd1, 0xdc, 0x37, 0x9a, 0xf6, 0x46, 0xd1, 0x7a, 0x02,
+    0x67, 0xc6, 0x19, 0x36, 0x68, 0xd7, 0x49, 0xa1, 0xa5, 0xa6, 0x9e, 0x44, 0xd8, 0xb0, 0xa5, 0xf6,
+    0x7d, 0x4f, 0x06, 0xe1, 0x03, 0x75, 0x70, 0x39, 0x8c, 0x16, 0xd9, 0x47, 0x59, 0x1d, 0x99, 0x95,
+    0xb4, 0xc6, 0x7d, 0x81, 0x48, 0xb6, 0x11, 0x89, 0x0f, 0x96, 0x52, 0x4f, 0x94, 0xeb, 0xf4, 0x91,
+    0x76, 0x8d, 0xa8, 0xb0, 0xa2, 0x61, 0xdc, 0x50, 0xad, 0x9e, 0x9d, 0x3f, 0xdd, 0xaa, 0x8d, 0x4a,
+    0x69, 0x52, 0xad, 0x26, 0xeb, 0xb2, 0xf3, 0xfa, 0x90, 0x91, 0x36, 0x7b, 0x50, 0x16, 0x53, 0xca,
+    0xae, 0x22, 0x06, 0xd1, 0xae, 0x00, 0x6e, 0x07, 0x15, 0x46, 0x3d, 0x05, 0x73, 0xb8, 0xaf, 0x4f,
+    0x9a, 0xc9, 0xe1, 0x23, 0x5f, 0xd2, 0x8c, 0x6e, 0x84, 0x55, 0x39, 0x45, 0x56, 0x19, 0xde, 0x23,
+    0x9c, 0xd7, 0xc8, 0x28, 0x16, 0xed, 0x19, 0xb6, 0x37, 0x3f, 0x7e, 0xc2, 0x5b, 0x0f, 0x05, 0x80,
+    0x26, 0x26, 0xc5, 0xa4, 0xe1, 0xe6, 0xdb, 0x77, 0x20, 0x87, 0x9d, 0x25, 0x78, 0xf7, 0xe6, 0xf2,
+    0x35, 0xa4, 0x31, 0x94, 0x5b, 0x04, 0xef, 0xe0, 0xe0, 0xc7, 0x08, 0x1f, 0x3b, 0xff, 0x75, 0x73,
+    0xbf, 0xc8, 0x2c, 0xdc, 0x61, 0xfc, 0xdb, 0xc0, 0xcc, 0x95, 0xce, 0xcc, 0x07, 0xba, 0x4b, 0x04,
+    0x63, 0x6d, 0xce, 0x4a, 0x1c, 0xbd, 0xbb, 0x6a, 0xb5, 0x49, 0x41, 0x56, 0x33, 0x78, 0x01, 0x32,
+    0x05, 0x74, 0xd3, 0x19, 0x86, 0xc2, 0x88, 0xf6, 0x65, 0x26, 0x73, 0xe8, 0x76, 0x95, 0x87, 0xe4,
+    0xd4, 0x18, 0x53, 0xb9, 0xab, 0x53, 0x82, 0x99, 0xfb, 0x67, 0xbd, 0xae, 0x74, 0xfe, 0xb4, 0xdc,
+    0x44, 0xfd, 0xa7, 0xc1, 0x57, 0xa7, 0x25, 0x83, 0x4f, 0xa2, 0xdd, 0x9e, 0x6d, 0x1f, 0x29, 0x89,
+    0xcb, 0x04, 0xe6, 0xf9, 0xcb, 0x7a, 0xc8, 0x24, 0x80, 0x31, 0x5e, 0x95, 0x27, 0xf2, 0xa9, 0xb3,
+    0x58, 0xec, 0xfd, 0xe1, 0x64, 0x85, 0x77, 0x7a, 0xb5, 0x2c, 0xe7, 0xc5, 0xf2, 0x4b, 0x2a, 0x9a,
+    0xc0, 0x90, 0xa2, 0xfa, 0x3d, 0xda, 0xcf, 0xeb, 0xfa, 0xa2, 0x3b, 0xdf, 0x6d, 0x37, 0x9f, 0x53,
+    0x69, 0xf7, 0x71, 0x47, 0xc9, 0x98, 0x66, 0x3b, 0x0f, 0x66, 0x79, 0xa9, 0xab, 0x5f, 0x3c, 0x0b,
+    0x2d, 0x32, 0xc0, 0x03, 0x00, 0x00,
+};
+
+// index.html: 7380 -> 2330 bytes
+static const uint8_t k_index_html[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xc5, 0x59, 0xe9, 0x72, 0xdb, 0xc8,
+    0x11, 0xfe, 0xef, 0xa7, 0x18, 0x43, 0x15, 0x03, 0x4c, 0x44, 0xf0, 0xd0, 0x11, 0x0b, 0x20, 0x91,
+    0xda, 0x95, 0xe8, 0x5a, 0xa5, 0x1c, 0x4b, 0x55, 0x94, 0xb3, 0x49, 0xa5, 0xf2, 0x63, 0x00, 0x0c,
+    0xc9, 0xb1, 0x40, 0x0c, 0x02, 0x0c, 0x44, 0x29, 0x2c, 0xbd, 0x54, 0x1e, 0x21, 0x4f, 0x96, 0x9e,
+    0x03, 0x20, 0x4e, 0xae, 0xed, 0xad, 0xca, 0xea, 0x87, 0x8c, 0x63, 0xfa, 0xfa, 0xba, 0xfb, 0xeb,
+    0x86, 0x3c, 0x7b, 0x7b, 0x73, 0x77, 0xfd, 0xf0, 0xf7, 0xfb, 0x05, 0xda, 0xf0, 0x6d, 0xe4, 0xbd,
+    0x99, 0x15, 0xff, 0x10, 0x1c, 0x7a, 0x6f, 0x10, 0xfc, 0xcc, 0x38, 0xe5, 0x11, 0xf1, 0x7e, 0xa6,
+    0x1f, 0x28, 0x5a, 0x12, 0x9e, 0x27, 0xb3, 0x91, 0x7a, 0xa2, 0xde, 0x6e, 0x09, 0xc7, 0x28, 0xc6,
+    0x5b, 0x32, 0x37, 0x9e, 0x28, 0xd9, 0x25, 0x2c, 0xe5, 0x06, 0x0a, 0x58, 0xcc, 0x49, 0xcc, 0xe7,
+    0xc6, 0x8e, 0x86, 0x7c, 0x33, 0x3f, 0x9b, 0x8e, 0x4f, 0x69, 0x4c, 0x39, 0xc5, 0xd1, 0x30, 0x0b,
+    0x70, 0x44, 0xe6, 0x13, 0x43, 0x8b, 0x67, 0xfc, 0xa5, 0x50, 0x25, 0x7e, 0x7c, 0x16, 0xbe, 0xa0,
+    0xbd, 0x8f, 0x83, 0xc7, 0x75, 0xca, 0xf2, 0x38, 0x74, 0x4e, 0x26, 0x93, 0x89, 0x1b, 0xb0, 0x88,
+    0xa5, 0xce, 0xc9, 0x62, 0xb1, 0x70, 0x57, 0xa0, 0x79, 0xb8, 0xc2, 0x5b, 0x1a, 0xbd, 0x38, 0x19,
+    0x8e, 0xb3, 0x61, 0x46, 0x52, 0xba, 0x72, 0x5f, 0x4b, 0x0d, 0xb6, 0xb0, 0x8d, 0x69, 0x4c, 0x52,
+    0xb4, 0xdf, 0xe2, 0xe7, 0xa1, 0xf4, 0xc0, 0x39, 0x3b, 0x1f, 0x27, 0xcf, 0xee, 0x16, 0xa7, 0x6b,
+    0x1a, 0x3b, 0xd3, 0xf3, 0xe4, 0x19, 0xe1, 0x9c, 0x33, 0xb7, 0x6a, 0x68, 0x3a, 0x9d, 0xba, 0x09,
+    0x0e, 0x43, 0x1a, 0xaf, 0x9d, 0x29, 0xd9, 0xba, 0x3e, 0x4b, 0x43, 0x92, 0x0e, 0x53, 0x1c, 0xd2,
+    0x3c, 0x73, 0x26, 0x53, 0x90, 0xf7, 0xd9, 0xf3, 0x30, 0xdb, 0xe0, 0x90, 0xed, 0x9c, 0x31, 0x1a,
+    0xa3, 0xc9, 0x25, 0xe8, 0x39, 0x19, 0x8f, 0xc7, 0xef, 0x2b, 0xf6, 0x69, 0x9c, 0xe4, 0xfc, 0x34,
+    0x23, 0x11, 0x09, 0xf8, 0xa9, 0x9f, 0x73, 0xce, 0x62, 0xb4, 0x57, 0x4e, 0x4c, 0xc6, 0xe3, 0xdf,
+    0x29, 0x1d, 0xf4, 0xdf, 0xc2, 0x8a, 0xb6, 0x00, 0x4f, 0x0a, 0xcf, 0xec, 0x3f, 0x92, 0x2d, 0x1a,
+    0x97, 0x6e, 0xd8, 0x97, 0xe0, 0x87, 0x8c, 0x18, 0x24, 0x88, 0x33, 0xb1, 0xc7, 0x17, 0x2d, 0xc7,
+    0xde, 0x4b, 0xbf, 0xc4, 0x13, 0x67, 0x02, 0xee, 0x64, 0x2c, 0xa2, 0x21, 0x3a, 0xb9, 0xb8, 0xb8,
+    0x70, 0x8f, 0xa0, 0x58, 0x81, 0xcb, 0xe7, 0xf1, 0x30, 0x49, 0x29, 0x38, 0xd0, 0x00, 0x7e, 0x7a,
+    0x75, 0x85, 0xa7, 0x81, 0x96, 0xda, 0x6d, 0x28, 0x27, 0x85, 0x65, 0xad, 0x48, 0x1f, 0x68, 0xe8,
+    0x0a, 0x71, 0xbc, 0x16, 0xd8, 0x57, 0x55, 0x61, 0x80, 0xb6, 0x5f, 0x8f, 0x78, 0xdb, 0x50, 0xc2,
+    0xa0, 0xa6, 0xea, 0xce, 0x5c, 0x5e, 0x60, 0x7c, 0x71, 0xcc, 0x19, 0x75, 0xa0, 0xa1, 0x67, 0x47,
+    0xfc, 0xba, 0x9e, 0x33, 0xff, 0xfd, 0x74, 0x75, 0x79, 0x44, 0x8f, 0x3e, 0x50, 0xd1, 0x93, 0x71,
+    0xcc, 0xf3, 0x4c, 0x14, 0x93, 0x48, 0xd1, 0x90, 0xb3, 0xc4, 0x99, 0xd4, 0xd2, 0x62, 0x5f, 0x89,
+    0xac, 0x1c, 0x24, 0x22, 0xec, 0x93, 0x08, 0xed, 0x43, 0x9a, 0x25, 0x11, 0x7e, 0x71, 0xfc, 0x88,
+    0x05, 0x8f, 0x6e, 0x45, 0xda, 0x16, 0xc7, 0xf5, 0xbd, 0xcf, 0xa0, 0x40, 0xb6, 0x8e, 0x3d, 0xa9,
+    0x69, 0xb0, 0x53, 0xb6, 0x3b, 0x28, 0x58, 0x45, 0xe4, 0xd9, 0x5d, 0x63, 0x30, 0x2b, 0x6a, 0x18,
+    0x47, 0x74, 0x1d, 0x0f, 0xc1, 0xf1, 0x6d, 0xe6, 0x04, 0xd0, 0x63, 0x24, 0x6d, 0x0a, 0x7a, 0xe8,
+    0xf7, 0x68, 0x2f, 0x84, 0x9c, 0x49, 0xf5, 0x55, 0x42, 0xa3, 0x8a, 0x57, 0x34, 0x8e, 0xa0, 0x47,
+    0x86, 0xca, 0xb9, 0xb2, 0xde, 0xce, 0xc0, 0x35, 0x24, 0xab, 0xae, 0x5e, 0x64, 0x57, 0x57, 0x57,
+    0xa2, 0xcc, 0xaa, 0x40, 0x9e, 0x9d, 0xf5, 0x94, 0x5d, 0x05, 0x98, 0xf7, 0x95, 0x48, 0x23, 0xb2,
+    0xe2, 0x0e, 0x34, 0x4c, 0x0d, 0xda, 0x1d, 0xe5, 0xc1, 0x06, 0xed, 0x13, 0x96, 0x01, 0x39, 0xb0,
+    0xd8, 0x41, 0x29, 0x89, 0x30, 0xa7, 0x4f, 0xc4, 0x45, 0x85, 0xa3, 0xa8, 0xe6, 0x29, 0x52, 0x9d,
+    0x84, 0x2e, 0x44, 0x3b, 0xa2, 0x0d, 0xa1, 0xeb, 0x0d, 0x77, 0xd0, 0x54, 0x34, 0x01, 0x7a, 0x22,
+    0x29, 0xa7, 0xc0, 0x2e, 0x43, 0x09, 0x91, 0xb3, 0xa5, 0x61, 0x18, 0x91, 0x0e, 0x73, 0xb2, 0x43,
+    0xd1, 0x9e, 0x25, 0x38, 0xa0, 0x1c, 0x0c, 0x8c, 0x4b, 0xad, 0xe3, 0x83, 0xca, 0x71, 0x4d, 0x10,
+    0x82, 0x13, 0x35, 0x7d, 0xf0, 0x13, 0xfb, 0x10, 0x71, 0x0e, 0xd5, 0x83, 0x82, 0x3c, 0xcd, 0xa0,
+    0x70, 0x50, 0xc2, 0xa8, 0x4c, 0x06, 0x12, 0x29, 0x16, 0x9a, 0x64, 0xc0, 0xe2, 0x22, 0x2d, 0x34,
+    0x22, 0x9d, 0x6d, 0x79, 0x59, 0x62, 0xa9, 0x2b, 0x4f, 0x81, 0x87, 0x78, 0x0a, 0xa4, 0xa6, 0x8d,
+    0xd8, 0xd3, 0x4c, 0xc8, 0x54, 0x13, 0xa1, 0x42, 0x6d, 0xb9, 0xe6, 0xf8, 0x64, 0xc5, 0x52, 0xd2,
+    0xe3, 0xa1, 0x22, 0x63, 0x07, 0x19, 0x46, 0x05, 0x32, 0x09, 0xa0, 0x8e, 0x5b, 0xdd, 0x28, 0x87,
+    0xcf, 0xc4, 0x65, 0xe1, 0xa8, 0xba, 0x69, 0xb9, 0xaa, 0x1a, 0xe7, 0x97, 0x7c, 0xbd, 0x00, 0xb6,
+    0x6b, 0xf0, 0xa2, 0x13, 0x6c, 0x48, 0xf0, 0x48, 0x42, 0xf4, 0x87, 0x03, 0xa8, 0x1d, 0x48, 0xb4,
+    0x98, 0xa5, 0x47, 0xb8, 0x0c, 0x5b, 0x7a, 0x02, 0x97, 0xe0, 0xb2, 0xbc, 0x84, 0x22, 0x22, 0x7f,
+    0xb3, 0x04, 0xcf, 0x0f, 0x6a, 0x60, 0x01, 0x27, 0x53, 0xc1, 0xc7, 0xd5, 0x5e, 0x16, 0x80, 0xea,
+    0x06, 0x50, 0x0f, 0xa6, 0x25, 0xa3, 0xaa, 0x7b, 0x28, 0xef, 0x10, 0x67, 0x1b, 0x30, 0x7c, 0x72,
+    0x7e, 0x7e, 0x5e, 0xd3, 0xb7, 0xc5, 0xa2, 0xa7, 0xaa, 0x54, 0x00, 0x05, 0xaf, 0x99, 0xc4, 0xf7,
+    0x7d, 0x7d, 0x76, 0x36, 0xd2, 0x53, 0x6e, 0x36, 0x52, 0x63, 0x75, 0x26, 0xc6, 0x9c, 0x1e, 0x80,
+    0x21, 0x7d, 0x42, 0x41, 0x84, 0xb3, 0x6c, 0x6e, 0x94, 0x93, 0xcb, 0x38, 0x0c, 0x44, 0xf9, 0x5e,
+    0x8a, 0xeb, 0x61, 0xaa, 0xa6, 0x08, 0x27, 0xcf, 0x5c, 0xd7, 0xb9, 0x26, 0x81, 0x3a, 0xa1, 0x00,
+    0x9f, 0x54, 0x94, 0xa8, 0x49, 0x9b, 0xe0, 0xb8, 0xd0, 0x54, 0x9d, 0x29, 0xe5, 0x8c, 0xd9, 0xa9,
+    0xd2, 0xf0, 0x59, 0x14, 0xba, 0x86, 0xf7, 0xf0, 0x92, 0x10, 0x74, 0x83, 0xee, 0x3e, 0x2e, 0x6e,
+    0xd0, 0x62, 0x9b, 0x03, 0xa2, 0x2c, 0x2d, 0xe6, 0xbf, 0x50, 0x55, 0x71, 0x71, 0x04, 0x3e, 0x7a,
+    0x6f, 0xea, 0x2e, 0xeb, 0x90, 0x34, 0xe2, 0x4d, 0x5f, 0x2a, 0x27, 0x80, 0xb1, 0x8c, 0xc2, 0xad,
+    0x2f, 0x79, 0xc6, 0xe9, 0xea, 0x65, 0x58, 0x54, 0x2c, 0xd8, 0x09, 0xa0, 0xf3, 0x09, 0xdf, 0x11,
+    0xd2, 0xd4, 0xd1, 0x04, 0x47, 0x12, 0x5e, 0x1e, 0x67, 0x84, 0x1b, 0xde, 0xcc, 0xf7, 0x3e, 0x5e,
+    0x1f, 0xdc, 0x9e, 0x8d, 0x7c, 0x4f, 0x85, 0x4f, 0xc3, 0xb9, 0x41, 0xb6, 0xf9, 0x12, 0x28, 0x9d,
+    0x18, 0x85, 0x07, 0x82, 0x18, 0x0d, 0xcf, 0xb6, 0x6d, 0x1d, 0x98, 0x8e, 0xe7, 0x2b, 0x8d, 0x95,
+    0x3a, 0x25, 0xb9, 0xfc, 0x04, 0xe0, 0xd5, 0xf2, 0x57, 0xd3, 0xa0, 0x26, 0x83, 0x32, 0x6b, 0x2a,
+    0x36, 0x32, 0xbb, 0x8f, 0xca, 0xe3, 0x8a, 0xa8, 0x40, 0xbf, 0x09, 0xfa, 0x1f, 0xd8, 0x7a, 0x1d,
+    0x11, 0x13, 0x71, 0xc8, 0xcb, 0xdc, 0x94, 0xad, 0x00, 0x8b, 0x83, 0x29, 0x78, 0x12, 0xfb, 0x11,
+    0x14, 0x27, 0x8b, 0x83, 0x8d, 0x98, 0xbd, 0x73, 0x93, 0xcb, 0xa3, 0x10, 0xbd, 0xc5, 0x37, 0x34,
+    0xb3, 0x75, 0xdb, 0x0c, 0x8e, 0x99, 0x92, 0xe8, 0x14, 0x8e, 0xa9, 0xc6, 0x94, 0x2d, 0x69, 0x7a,
+    0xcd, 0x6c, 0xd7, 0xc4, 0x46, 0x32, 0xa2, 0x0e, 0xac, 0xda, 0x10, 0x76, 0x3d, 0xaa, 0x16, 0x8a,
+    0x68, 0x25, 0xa8, 0x3a, 0xe9, 0x3a, 0xe2, 0x1b, 0x82, 0x3e, 0x2f, 0xa7, 0xe3, 0xcb, 0x4b, 0x44,
+    0x8a, 0xda, 0xb3, 0x6e, 0xff, 0xfb, 0x9f, 0x6b, 0x04, 0xad, 0xfd, 0x44, 0x10, 0xe6, 0x68, 0xfc,
+    0x7c, 0x76, 0x3d, 0x80, 0xa0, 0x47, 0x6c, 0xb5, 0x02, 0x1e, 0xe3, 0x1b, 0x06, 0x58, 0xa5, 0xc4,
+    0x67, 0x8c, 0xdb, 0xe8, 0x46, 0x82, 0x02, 0x1d, 0x2d, 0x06, 0x0a, 0xc1, 0x19, 0xc9, 0xa4, 0x4a,
+    0xa9, 0xc1, 0xcf, 0x33, 0xbb, 0xe1, 0xcc, 0x77, 0x54, 0xb0, 0x20, 0x1b, 0x99, 0xfa, 0x1d, 0x5d,
+    0xd1, 0x0f, 0x70, 0x63, 0x80, 0x2f, 0x59, 0xee, 0x6f, 0x29, 0x6c, 0xbd, 0x29, 0xb4, 0x49, 0x1a,
+    0xa3, 0x15, 0x8e, 0x32, 0xe2, 0x76, 0xd5, 0xad, 0x82, 0x4d, 0xae, 0xd4, 0x9f, 0xa0, 0xba, 0x59,
+    0xfa, 0xd8, 0x0f, 0xa5, 0x5a, 0x25, 0xa5, 0xad, 0x2c, 0xa3, 0xe1, 0x4d, 0xca, 0x12, 0x58, 0x40,
+    0xe3, 0xb2, 0x69, 0x5a, 0x8d, 0xef, 0xf6, 0x95, 0x1f, 0x4b, 0x24, 0xfb, 0x3d, 0xe1, 0x28, 0x07,
+    0x39, 0xc3, 0xbb, 0x97, 0xd0, 0x20, 0x6d, 0x00, 0xb6, 0xf8, 0xc2, 0x15, 0x75, 0xb0, 0x2b, 0xad,
+    0xea, 0x6c, 0xc7, 0x1b, 0x55, 0xab, 0xb2, 0x38, 0x0d, 0x41, 0x4e, 0x46, 0xe9, 0xb0, 0x81, 0x60,
+    0x8e, 0x07, 0x64, 0x23, 0x3b, 0x63, 0x6e, 0x2c, 0x97, 0xb7, 0x37, 0xdf, 0xe6, 0xbb, 0x46, 0xeb,
+    0x1e, 0xd2, 0x01, 0xee, 0x85, 0xfd, 0x48, 0x55, 0x7d, 0x48, 0xf4, 0x69, 0xe5, 0x87, 0xb8, 0x6b,
+    0xf8, 0x21, 0xc1, 0x2f, 0x74, 0xf6, 0x71, 0x4b, 0x85, 0xa3, 0x7a, 0x30, 0xd5, 0x1b, 0xbe, 0x32,
+    0xaa, 0x6e, 0x44, 0x25, 0x04, 0x11, 0x0d, 0x1e, 0x21, 0x7e, 0x28, 0x56, 0x6b, 0x50, 0x32, 0x4d,
+    0x65, 0xd7, 0x36, 0xbc, 0x6b, 0x16, 0xc7, 0x02, 0xf7, 0x77, 0x68, 0x09, 0xa7, 0x80, 0xa3, 0xa4,
+    0xf0, 0x77, 0x99, 0x81, 0x62, 0x5c, 0x13, 0xde, 0x30, 0xa4, 0x16, 0x71, 0xc3, 0xfb, 0x20, 0x5f,
+    0x22, 0x11, 0x6f, 0xbf, 0x91, 0x63, 0x9c, 0xf7, 0x6b, 0x41, 0xd8, 0xd1, 0x18, 0x0a, 0xd6, 0x86,
+    0xfd, 0x0d, 0x8b, 0xb2, 0x9a, 0x9b, 0x23, 0x58, 0xef, 0xcd, 0x9a, 0xaf, 0xf0, 0xc0, 0xf0, 0xee,
+    0x1e, 0x7e, 0x40, 0x9f, 0x93, 0x10, 0xa8, 0xf9, 0x57, 0x81, 0xd1, 0x36, 0x07, 0x14, 0x52, 0x37,
+    0x07, 0x9f, 0x05, 0x86, 0xf7, 0x33, 0x7c, 0x1b, 0xfc, 0x15, 0xbe, 0x58, 0x7f, 0x1b, 0x50, 0x56,
+    0x04, 0xc8, 0xdf, 0x32, 0x47, 0x79, 0x98, 0x8c, 0x12, 0x20, 0x2a, 0xf3, 0x74, 0x0f, 0x5f, 0xd2,
+    0x1b, 0x16, 0x3a, 0xe6, 0xfd, 0xdd, 0xf2, 0xc1, 0x7c, 0x1d, 0xd8, 0xc0, 0x58, 0xb1, 0x95, 0xce,
+    0xbd, 0xd4, 0x16, 0x0d, 0x65, 0x0d, 0xf4, 0x13, 0x3e, 0xf7, 0xe0, 0x0b, 0x3a, 0xe5, 0x16, 0x87,
+    0x27, 0x10, 0x23, 0xa8, 0xb1, 0x06, 0xc5, 0x33, 0xf3, 0x5e, 0x90, 0xde, 0x0a, 0x53, 0x98, 0x08,
+    0xe6, 0x60, 0xd0, 0x8e, 0xfa, 0x81, 0x64, 0x1c, 0x7d, 0xbe, 0xb9, 0x47, 0xe2, 0xe0, 0x37, 0x85,
+    0x3e, 0x1b, 0x09, 0xce, 0x3b, 0xc2, 0xe0, 0xf2, 0x3b, 0x49, 0xf7, 0xbd, 0xba, 0xf6, 0x96, 0xf2,
+    0x5f, 0xd8, 0x0e, 0xed, 0x1e, 0xca, 0x6d, 0x5e, 0x66, 0x41, 0x4a, 0x93, 0x0a, 0xbf, 0xac, 0xf2,
+    0x58, 0xad, 0x6c, 0x30, 0x6a, 0x17, 0x7a, 0x70, 0x3f, 0xe0, 0xb5, 0xc5, 0xe2, 0xc1, 0xbe, 0xe6,
+    0x09, 0xac, 0x0c, 0x10, 0x18, 0xc7, 0x6b, 0x34, 0x47, 0x21, 0x0b, 0xf2, 0x2d, 0xec, 0x0f, 0x36,
+    0xd4, 0xfd, 0x22, 0x22, 0xe2, 0xf2, 0xc7, 0x97, 0xdb, 0xd0, 0x32, 0x8b, 0xd1, 0x6f, 0x0e, 0xdc,
+    0x9a, 0x30, 0x88, 0x49, 0x8c, 0xaf, 0xd5, 0xde, 0x01, 0x2a, 0xc0, 0xe2, 0x9f, 0x90, 0xb9, 0xf8,
+    0xf4, 0xc3, 0x8f, 0xb0, 0xff, 0x98, 0xc8, 0x41, 0xe6, 0xcd, 0xed, 0x52, 0xdd, 0xb4, 0x45, 0x25,
+    0x99, 0xd9, 0x87, 0x3d, 0xb6, 0x94, 0x3f, 0x99, 0x5c, 0x9e, 0xfb, 0x93, 0xf7, 0x52, 0xfe, 0x04,
+    0xae, 0x2e, 0x27, 0x97, 0xfd, 0xe2, 0x72, 0xe3, 0xbc, 0x16, 0xbb, 0xe3, 0x41, 0x5e, 0x2d, 0xc2,
+    0x4a, 0x1e, 0x3e, 0x93, 0x2b, 0xc2, 0xaf, 0x6d, 0x88, 0x64, 0x49, 0x15, 0x20, 0x59, 0x0d, 0x7c,
+    0x8a, 0x7a, 0x8b, 0x82, 0x70, 0x94, 0x29, 0x0c, 0x2a, 0x05, 0xf6, 0x25, 0x63, 0x71, 0x59, 0x60,
+    0x5f, 0xe6, 0xde, 0xbe, 0x55, 0x10, 0x0d, 0xfc, 0xdf, 0xbe, 0xfd, 0x62, 0x93, 0x58, 0x2e, 0x1e,
+    0x0d, 0x2c, 0x2b, 0xc9, 0x50, 0xb3, 0xfc, 0x78, 0x3e, 0xf4, 0x5a, 0xd3, 0xa1, 0x84, 0xae, 0x90,
+    0xa5, 0x54, 0x0c, 0xd0, 0x5e, 0x2b, 0x2b, 0x76, 0x19, 0x50, 0x5a, 0xf1, 0xc0, 0x2d, 0xde, 0x96,
+    0xbb, 0xd0, 0x5c, 0xcf, 0xde, 0x0a, 0x4c, 0x12, 0xb4, 0x6a, 0xc3, 0xec, 0x5f, 0x07, 0x47, 0xe1,
+    0x3c, 0x6c, 0x51, 0xad, 0x62, 0x53, 0x60, 0xaa, 0x1c, 0x49, 0x44, 0x95, 0x23, 0x32, 0x4f, 0xf2,
+    0x5e, 0x3b, 0x62, 0x9e, 0xa2, 0x66, 0x57, 0xb7, 0xc2, 0x54, 0x98, 0x0b, 0x87, 0x1a, 0xf9, 0xab,
+    0x79, 0xd7, 0x76, 0x2f, 0x8f, 0xe9, 0xbf, 0x2c, 0x9c, 0xa6, 0x83, 0x3d, 0xd2, 0xeb, 0xc6, 0x3f,
+    0xa0, 0xcb, 0x62, 0xb2, 0x13, 0x4b, 0xba, 0x78, 0x61, 0xaf, 0x68, 0x04, 0x1f, 0x06, 0x56, 0x36,
+    0xf7, 0x32, 0xf4, 0xee, 0x1d, 0xca, 0x6c, 0x0e, 0xa3, 0xc7, 0x1a, 0xd8, 0x11, 0x89, 0xd7, 0x7c,
+    0x33, 0x18, 0xfc, 0xb3, 0x0a, 0x4f, 0x04, 0x23, 0x22, 0x0b, 0x70, 0x1c, 0x03, 0x2d, 0xcc, 0x15,
+    0x78, 0x1d, 0x4d, 0x08, 0x07, 0x2c, 0xc8, 0xc6, 0x9b, 0x66, 0x9e, 0x0a, 0xc9, 0x81, 0xf6, 0xc5,
+    0x3d, 0xe8, 0xe2, 0x69, 0x4e, 0xdc, 0xce, 0x52, 0x14, 0x47, 0xca, 0x2a, 0x44, 0x73, 0x0f, 0x35,
+    0xea, 0x30, 0xa2, 0x50, 0x44, 0xf0, 0xb8, 0x5d, 0x8c, 0xea, 0x8d, 0x82, 0x40, 0x5c, 0x0f, 0x6c,
+    0xf8, 0x04, 0xe7, 0x96, 0x85, 0x4f, 0x7d, 0xc1, 0x84, 0x92, 0xfb, 0x23, 0x72, 0xcd, 0xb6, 0x09,
+    0x4e, 0x89, 0xe5, 0x0f, 0x3a, 0xaa, 0x4b, 0xc4, 0x1b, 0xea, 0x55, 0xea, 0x58, 0x89, 0x56, 0x57,
+    0xae, 0xae, 0x2a, 0x2d, 0x74, 0xd8, 0x14, 0xa6, 0x79, 0xfa, 0xd3, 0xc3, 0x5f, 0x3e, 0x82, 0x36,
+    0xd3, 0xec, 0x31, 0x48, 0x56, 0x38, 0x8f, 0xf8, 0x5d, 0xc2, 0xab, 0x26, 0x83, 0x94, 0x40, 0xc2,
+    0xb5, 0x55, 0xcb, 0x54, 0xcb, 0x57, 0xa7, 0xad, 0x52, 0xdc, 0x96, 0x3b, 0x5c, 0x8f, 0xa5, 0xca,
+    0x31, 0x41, 0x6a, 0xe2, 0x54, 0xcf, 0xa6, 0x67, 0x1e, 0x89, 0x07, 0x27, 0x09, 0x89, 0xc3, 0xeb,
+    0x0d, 0x8d, 0x42, 0xeb, 0xa0, 0xb1, 0x0b, 0x49, 0x48, 0x80, 0x0d, 0xa3, 0x61, 0x81, 0x21, 0xab,
+    0x02, 0xae, 0xee, 0x9c, 0x15, 0x18, 0xb0, 0xef, 0x0c, 0x5e, 0xfc, 0xb0, 0x4a, 0xe4, 0xc2, 0x52,
+    0xff, 0x29, 0x1d, 0x78, 0xff, 0xa1, 0xce, 0x38, 0x59, 0x67, 0x80, 0xaf, 0xc7, 0xd2, 0x5e, 0x7c,
+    0x75, 0x09, 0xca, 0xd1, 0x6d, 0xd2, 0xea, 0x90, 0x52, 0xe8, 0x58, 0x91, 0x41, 0x27, 0x14, 0xa1,
+    0x95, 0xca, 0xe5, 0x83, 0x0e, 0x87, 0xdc, 0x3e, 0x56, 0xeb, 0x69, 0x97, 0xdf, 0xa2, 0xd6, 0xbf,
+    0x37, 0xcf, 0xec, 0x17, 0xaa, 0xbb, 0x92, 0x5d, 0x73, 0x09, 0x0c, 0x52, 0x2c, 0x3b, 0x5f, 0x59,
+    0xca, 0xed, 0x14, 0x03, 0x7c, 0x2b, 0x1a, 0xc3, 0xd7, 0xe7, 0x8b, 0x1a, 0x0b, 0x4d, 0x1a, 0x44,
+    0xdd, 0x73, 0x02, 0x06, 0xe2, 0xad, 0xf8, 0xc3, 0x0b, 0xf8, 0x2a, 0xe9, 0xef, 0x14, 0x9d, 0x8d,
+    0xc7, 0xe3, 0xca, 0x51, 0xbd, 0x87, 0xb2, 0x38, 0x62, 0x38, 0xac, 0x95, 0x47, 0x3d, 0x43, 0x8a,
+    0x54, 0x3b, 0x28, 0xf2, 0x30, 0x0a, 0x2a, 0xf6, 0xbb, 0x58, 0x59, 0x7e, 0x64, 0x34, 0xf2, 0x2e,
+    0xf9, 0x5c, 0x36, 0xe3, 0xd7, 0x95, 0x9d, 0xdb, 0x92, 0x16, 0xdf, 0x4c, 0xc7, 0xa4, 0xc5, 0xfb,
+    0x6e, 0xe9, 0x92, 0xe0, 0xc1, 0x31, 0x31, 0x02, 0x5b, 0x99, 0xd1, 0x33, 0x11, 0xa9, 0xa1, 0x78,
+    0xda, 0x7a, 0x2f, 0xfe, 0x4a, 0x46, 0x52, 0xd8, 0x1b, 0xf7, 0xa6, 0x5e, 0xc9, 0x86, 0xe2, 0xcf,
+    0x51, 0x26, 0x48, 0x40, 0x2e, 0x61, 0x81, 0x96, 0x9b, 0xfd, 0x48, 0x4c, 0x0b, 0xf3, 0xb5, 0x2d,
+    0x2e, 0xfe, 0xba, 0xe6, 0xa0, 0x3f, 0x2f, 0xef, 0x3e, 0xc1, 0x6e, 0x95, 0x42, 0x26, 0xe9, 0xea,
+    0xc5, 0xda, 0x8b, 0x68, 0x1d, 0xf1, 0xeb, 0x54, 0x78, 0xee, 0x88, 0x5f, 0x8d, 0x71, 0xfc, 0x5a,
+    0x1f, 0x46, 0xf5, 0xad, 0xbb, 0xbb, 0xb5, 0xfa, 0xb1, 0x95, 0x9b, 0x2f, 0xe0, 0x23, 0x7b, 0xe5,
+    0x41, 0x15, 0x2c, 0x6f, 0x56, 0xde, 0xf1, 0x7d, 0x4e, 0x7f, 0xd5, 0xa1, 0xee, 0x4d, 0x4e, 0xbd,
+    0x36, 0xff, 0xcf, 0x3e, 0x7f, 0x0b, 0x8f, 0x75, 0x0e, 0xa7, 0xaf, 0x29, 0xa7, 0x0e, 0xd9, 0x36,
+    0x56, 0xb3, 0x51, 0xf1, 0xb1, 0x00, 0x9f, 0x31, 0xf2, 0xef, 0xa9, 0xb3, 0x91, 0xfa, 0xcf, 0xcb,
+    0xff, 0x01, 0x57, 0x3c, 0x38, 0x8b, 0xd4, 0x1c, 0x00, 0x00,
+};
+
+// ota.html: 2787 -> 1126 bytes
+static const uint8_t k_ota_html[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x56, 0x61, 0x6f, 0xdb, 0x36,
+    0x10, 0xfd, 0xde, 0x5f, 0xc1, 0x2a, 0xc8, 0x64, 0x6f, 0x31, 0x2d, 0xab, 0x75, 0xd6, 0x48, 0x96,
+    0x87, 0x35, 0x4d, 0xb0, 0x61, 0xeb, 0x52, 0x34, 0x29, 0xba, 0xa1, 0xe8, 0x07, 0x5a, 0x3a, 0x59,
+    0x44, 0x25, 0x52, 0xa3, 0xa8, 0xc8, 0x9e, 0xe1, 0xff, 0xbe, 0xa3, 0x24, 0xdb, 0x72, 0x62, 0xa7,
+    0x28, 0x86, 0x09, 0x41, 0xc2, 0x90, 0xef, 0xee, 0x1e, 0xef, 0xdd, 0x9d, 0x34, 0x79, 0xfe, 0xe6,
+    0xe6, 0xf2, 0xee, 0xaf, 0x77, 0x57, 0x24, 0xd1, 0x59, 0x3a, 0x7d, 0x36, 0xd9, 0xfc, 0x01, 0x16,
+    0x4d, 0x9f, 0x11, 0x7c, 0x26, 0x9a, 0xeb, 0x14, 0xa6, 0x37, 0x77, 0x3f, 0x93, 0x0f, 0x79, 0xc4,
+    0x34, 0x4c, 0x86, 0xcd, 0x4e, 0x73, 0x9a, 0x81, 0x66, 0x44, 0xb0, 0x0c, 0x02, 0xeb, 0x9e, 0x43,
+    0x95, 0x4b, 0xa5, 0x2d, 0x12, 0x4a, 0xa1, 0x41, 0xe8, 0xc0, 0xaa, 0x78, 0xa4, 0x93, 0xe0, 0x85,
+    0xeb, 0x9c, 0x71, 0xc1, 0x35, 0x67, 0xe9, 0xa0, 0x08, 0x59, 0x0a, 0xc1, 0xc8, 0x6a, 0xcd, 0x0b,
+    0xbd, 0xdc, 0xb8, 0x32, 0xcf, 0x4c, 0x46, 0x4b, 0xb2, 0x9a, 0xb1, 0xf0, 0xcb, 0x5c, 0xc9, 0x52,
+    0x44, 0xde, 0xc9, 0x68, 0x34, 0xf2, 0x43, 0x99, 0x4a, 0xe5, 0x9d, 0x5c, 0x5d, 0x5d, 0xf9, 0x31,
+    0x7a, 0x1e, 0xc4, 0x2c, 0xe3, 0xe9, 0xd2, 0x2b, 0x98, 0x28, 0x06, 0x05, 0x28, 0x1e, 0xfb, 0xeb,
+    0xad, 0x07, 0x6a, 0x62, 0x33, 0x2e, 0x40, 0x91, 0x55, 0xc6, 0x16, 0x83, 0x9a, 0x81, 0xf7, 0xe2,
+    0xdc, 0xc9, 0x17, 0x7e, 0xc6, 0xd4, 0x9c, 0x0b, 0xcf, 0x7d, 0x99, 0x2f, 0x08, 0x2b, 0xb5, 0xf4,
+    0xbb, 0x81, 0x5c, 0xd7, 0xf5, 0x73, 0x16, 0x45, 0x5c, 0xcc, 0x3d, 0x17, 0x32, 0x7f, 0x26, 0x55,
+    0x04, 0x6a, 0xa0, 0x58, 0xc4, 0xcb, 0xc2, 0x1b, 0xb9, 0x68, 0x3f, 0x93, 0x8b, 0x41, 0x91, 0xb0,
+    0x48, 0x56, 0x9e, 0x43, 0x1c, 0x32, 0x3a, 0x47, 0x3f, 0x27, 0x8e, 0xe3, 0xbc, 0xea, 0xc4, 0xe7,
+    0x22, 0x2f, 0xf5, 0x27, 0xbd, 0xcc, 0x21, 0x88, 0x79, 0x0a, 0x9f, 0xcf, 0x66, 0xa5, 0xd6, 0x52,
+    0x90, 0x55, 0x43, 0x64, 0xe4, 0x38, 0xa7, 0x8d, 0x1f, 0xfe, 0x8f, 0x89, 0xd4, 0x46, 0xc1, 0x9d,
+    0x0d, 0x3b, 0xfa, 0x23, 0x64, 0xc4, 0xd9, 0x52, 0xa1, 0xe7, 0xc8, 0xa5, 0xbe, 0x35, 0x5a, 0x80,
+    0x37, 0xa2, 0xce, 0xf8, 0x11, 0xb9, 0x57, 0x35, 0x37, 0xb3, 0xe3, 0x8d, 0x90, 0x52, 0x21, 0x53,
+    0x1e, 0x91, 0x93, 0xf1, 0x78, 0xec, 0x3f, 0x91, 0xc9, 0x4e, 0xca, 0x66, 0x5a, 0xec, 0x27, 0xdd,
+    0x3d, 0x1f, 0x33, 0x36, 0x6e, 0xd1, 0x55, 0xc2, 0x35, 0x6c, 0x22, 0xb6, 0x0e, 0x5a, 0x40, 0xc7,
+    0x47, 0xa1, 0x99, 0x2e, 0x0b, 0x93, 0x73, 0x73, 0x8b, 0x81, 0x96, 0xb9, 0x37, 0xda, 0x63, 0x4e,
+    0x2f, 0x0c, 0xf1, 0x6e, 0x54, 0xa6, 0x3e, 0x2a, 0x96, 0x3f, 0x96, 0xfb, 0xc8, 0x55, 0x1e, 0x5d,
+    0x59, 0xde, 0x83, 0x8a, 0x53, 0x14, 0x23, 0xe1, 0x51, 0x04, 0xc2, 0x4f, 0x80, 0xcf, 0x13, 0xed,
+    0x19, 0x59, 0xfc, 0x0e, 0x0d, 0x8a, 0x71, 0xf7, 0xc3, 0x92, 0xd5, 0x06, 0x6a, 0xd4, 0x68, 0x84,
+    0xc1, 0x45, 0x03, 0x9a, 0x0c, 0xdb, 0x9a, 0x9c, 0x0c, 0x9b, 0x26, 0x98, 0x98, 0xa2, 0x6c, 0xcb,
+    0x35, 0xe2, 0xf7, 0x24, 0x4c, 0x59, 0x51, 0x04, 0xd6, 0xb6, 0xce, 0xac, 0x5d, 0xf9, 0x4e, 0x12,
+    0x77, 0xaf, 0x51, 0xf0, 0xdf, 0xdd, 0x59, 0x5d, 0x19, 0x84, 0x47, 0x81, 0x15, 0x57, 0x16, 0xa9,
+    0x2b, 0xc4, 0x32, 0x25, 0x62, 0x11, 0x16, 0x86, 0x90, 0x63, 0xb7, 0xd0, 0x19, 0x17, 0x5d, 0x6f,
+    0x6d, 0xe9, 0xb4, 0x01, 0x51, 0x25, 0x8b, 0x48, 0x11, 0xa6, 0x3c, 0xfc, 0x12, 0x58, 0x91, 0xfc,
+    0x90, 0xa7, 0x92, 0x45, 0xbd, 0xbe, 0x35, 0x6d, 0x56, 0xe4, 0x3b, 0x72, 0x8d, 0xc8, 0x64, 0x32,
+    0x6c, 0xec, 0x3a, 0x8e, 0x3a, 0xb4, 0xdb, 0xac, 0x5b, 0xd3, 0x7a, 0xd3, 0xb0, 0xc1, 0x1d, 0xab,
+    0x73, 0x8a, 0x27, 0x43, 0x3c, 0x6a, 0x7f, 0xef, 0xfb, 0x30, 0xf0, 0x3c, 0xd4, 0x5b, 0x78, 0x23,
+    0xba, 0x35, 0x75, 0x4e, 0x8f, 0xa1, 0xa5, 0x66, 0xb7, 0x0d, 0xe8, 0xa1, 0xcd, 0x21, 0x8b, 0x16,
+    0xa2, 0x64, 0xd5, 0x49, 0xc3, 0x57, 0x53, 0x51, 0x71, 0x81, 0x2d, 0x49, 0x53, 0x19, 0x32, 0xcd,
+    0xa5, 0x08, 0xec, 0xa1, 0x6d, 0x91, 0x5a, 0xc4, 0xc0, 0xea, 0x96, 0x23, 0xb6, 0xbd, 0x6f, 0x4d,
+    0x5f, 0x63, 0xb5, 0x11, 0x2d, 0xc9, 0x47, 0x7e, 0xcd, 0xc9, 0x2d, 0xe8, 0x32, 0x7f, 0x9c, 0xb0,
+    0xaf, 0x86, 0x8c, 0x41, 0x87, 0x49, 0xcf, 0x1e, 0x2a, 0x98, 0x49, 0xa9, 0xed, 0xb3, 0x15, 0x8e,
+    0xc1, 0x44, 0x46, 0x9e, 0xfd, 0xee, 0xe6, 0xf6, 0xce, 0x5e, 0xf7, 0xa9, 0x4e, 0x40, 0xf4, 0x7a,
+    0xfd, 0x60, 0xba, 0x8a, 0x64, 0x58, 0x66, 0x38, 0x0c, 0xe9, 0x1c, 0xf4, 0x55, 0x0a, 0x66, 0xf9,
+    0x7a, 0xf9, 0x6b, 0xd4, 0xb3, 0xb7, 0xa9, 0xb1, 0xfb, 0x94, 0x0b, 0x2c, 0xa4, 0x3b, 0x58, 0xe8,
+    0xc0, 0x7e, 0x5f, 0xbb, 0xc4, 0xd6, 0xa7, 0x94, 0xda, 0xfe, 0xba, 0xff, 0xc4, 0x55, 0x1a, 0x28,
+    0xf9, 0x43, 0x56, 0x07, 0x34, 0xdf, 0xa5, 0xb7, 0xbb, 0x2c, 0x42, 0xc5, 0x73, 0xbd, 0x83, 0xc5,
+    0xa5, 0x08, 0x4d, 0xd2, 0xc8, 0xae, 0x9e, 0x56, 0x7b, 0x69, 0xc0, 0x32, 0x2f, 0x34, 0x89, 0x49,
+    0x40, 0x8e, 0x5e, 0x24, 0xae, 0xf0, 0x06, 0xa6, 0x92, 0x8b, 0x4f, 0xce, 0x67, 0x7f, 0xcf, 0x9a,
+    0xc7, 0xbd, 0xe7, 0x71, 0x7f, 0x45, 0x70, 0xe6, 0x2b, 0xdd, 0xb3, 0x2f, 0x13, 0x29, 0x0b, 0x20,
+    0x8c, 0x98, 0x4a, 0x27, 0x31, 0x57, 0x85, 0xb6, 0xfb, 0x3e, 0x51, 0xa8, 0x82, 0x12, 0x3e, 0x59,
+    0x1f, 0x88, 0xbc, 0x48, 0x14, 0xc6, 0x16, 0x50, 0x91, 0x3f, 0xdf, 0xfe, 0xfe, 0x8b, 0xd6, 0xf9,
+    0x7b, 0xf8, 0xbb, 0x84, 0x42, 0xf7, 0xfa, 0xfb, 0x91, 0x10, 0x47, 0x65, 0x8e, 0x49, 0x6f, 0x24,
+    0x38, 0xb3, 0x87, 0x65, 0xdd, 0x84, 0xf6, 0x99, 0x56, 0x25, 0x1c, 0x00, 0x97, 0xf5, 0x75, 0xa9,
+    0x14, 0xb9, 0x92, 0x73, 0x05, 0x45, 0x81, 0x61, 0x7a, 0x60, 0x14, 0xdb, 0x83, 0xb6, 0xb7, 0x00,
+    0x9a, 0x82, 0x98, 0xeb, 0xe4, 0x52, 0x66, 0xd8, 0xc5, 0x6c, 0x96, 0x42, 0xff, 0x31, 0x6e, 0xc7,
+    0x3a, 0x47, 0x67, 0x6f, 0x99, 0x4e, 0x68, 0x3d, 0xd6, 0x7a, 0xc6, 0x1c, 0x83, 0x41, 0x34, 0x04,
+    0xaa, 0x51, 0xf7, 0xb4, 0xff, 0x3d, 0x8e, 0x9e, 0x07, 0xa4, 0x36, 0xcf, 0xd1, 0x3c, 0x63, 0x73,
+    0x62, 0xa2, 0xeb, 0x6a, 0xa0, 0xf5, 0xd0, 0xc2, 0x20, 0x39, 0xf9, 0x81, 0xd8, 0xa7, 0xf6, 0x7f,
+    0xf0, 0xb4, 0x9b, 0xbe, 0xc6, 0xdd, 0x34, 0x40, 0x62, 0xe4, 0x27, 0x62, 0x9f, 0xb8, 0x17, 0x17,
+    0xcc, 0x0d, 0x6d, 0xe2, 0x99, 0x75, 0x3d, 0xee, 0xbf, 0x35, 0x0a, 0x4e, 0x8a, 0x6e, 0x69, 0x3f,
+    0xc5, 0x76, 0x5f, 0xf9, 0xf5, 0x01, 0x69, 0x85, 0xc2, 0x61, 0xbc, 0x34, 0xc3, 0x03, 0xc2, 0x84,
+    0x89, 0x39, 0x18, 0xb9, 0x8e, 0xa9, 0x65, 0x2c, 0x6a, 0xbc, 0x69, 0x30, 0x08, 0x82, 0xe0, 0xe5,
+    0x11, 0xb5, 0x5a, 0x6c, 0x33, 0x93, 0x10, 0xe7, 0xa2, 0x2a, 0x87, 0x91, 0x4f, 0xde, 0xf4, 0x60,
+    0x2b, 0x23, 0x41, 0xbb, 0x9d, 0xcc, 0x21, 0x56, 0x4d, 0x0a, 0x1a, 0x68, 0x33, 0xa1, 0xc9, 0xcd,
+    0x6f, 0xf4, 0x48, 0x32, 0xd7, 0x04, 0x52, 0xec, 0x90, 0xff, 0x81, 0x43, 0x8c, 0x5f, 0x60, 0x45,
+    0x02, 0x11, 0xa9, 0x38, 0x56, 0x4e, 0xfb, 0xba, 0xb6, 0x51, 0x90, 0x5d, 0x02, 0x8e, 0x50, 0xfa,
+    0x36, 0xb5, 0xda, 0x81, 0x21, 0x55, 0xd6, 0xf6, 0xed, 0x35, 0x2e, 0xdf, 0x30, 0xcd, 0x1e, 0x76,
+    0xac, 0x81, 0x50, 0x96, 0x63, 0xcf, 0x9a, 0x19, 0xc2, 0x55, 0x56, 0x31, 0x85, 0xed, 0x4a, 0x62,
+    0xfc, 0xa1, 0xe6, 0x8b, 0xf2, 0x40, 0xd3, 0x16, 0x06, 0x6c, 0x0c, 0x3b, 0x67, 0xdb, 0xd7, 0x76,
+    0x3b, 0xda, 0x70, 0x16, 0xd6, 0x2f, 0x6c, 0x7c, 0xfd, 0xd6, 0xdf, 0xb2, 0xff, 0x02, 0x40, 0xd4,
+    0xf0, 0x4f, 0xe3, 0x0a, 0x00, 0x00,
+};
+
+static const Asset kAssets[] = {
+    {"/a/emu.e1c3620c.css", "text/css; charset=utf-8", k_emu_css, sizeof(k_emu_css), "\"e1c3620c861ff747\"", true},
+    {"/a/emu.5118b6f0.js", "application/javascript; charset=utf-8", k_emu_js, sizeof(k_emu_js), "\"5118b6f0e3b1555d\"", true},
+    {"/emu", "text/html; charset=utf-8", k_emu_html, sizeof(k_emu_html), "\"4984977e8de92464\"", false},
+    {"/", "text/html; charset=utf-8", k_index_html, sizeof(k_index_html), "\"8d508953d96e409d\"", false},
+    {"/ota", "text/html; charset=utf-8", k_ota_html, sizeof(k_ota_html), "\"955395855b39150e\"", false},
+};
+
+// 5 files, 18011 bytes, 7062 gzipped
+
+} // namespace WebAssets
@@ -2,184 +2,660 @@
 
 #include <Arduino.h>
 #include <ESPAsyncWebServer.h>
-#include <ArduinoJson.h>
+#include <freertos/semphr.h>
+#include <lwip/tcpip.h>
+#include <lwip/priv/tcp_priv.h>
+#include <atomic>
 
 #include "wifimgr.h"
 #include "lcd_monitor.h"
+#include "frame_cache.h"
 
 namespace WebEmu {
 
 static AsyncEventSource sse("/emu/events");
-static uint32_t last_sent_ms = 0;
-static uint32_t last_ka_ms   = 0;   // keep-alive ticker
+static AsyncWebSocket ws("/emu/ws");
 
-// ---- helpers ----
-static String buildStateJson(const LCDMonitor::LCDState& st) {
-  StaticJsonDocument<512> doc;
-  doc["type"]  = "lcd20x4";
-  doc["disp"]  = st.display_on;
-  doc["cur"]   = st.cursor_on;
-  doc["blink"] = st.blink_on;
+// ---- /emu/ws binary stream ----
+// The UDP bin1 codec (lcd_frame.h) over a WebSocket: a TYPE_FULL keyframe on connect,
+// then one TYPE_DELTA per pushed frame against the previous one (spans and shifts, no
+// row dictionary). TCP never loses a delta, so every client holds the same base and one
+// encoding goes to all of them. A page that lost the chain (connected between two
+// pushes) sends any message and gets a keyframe of the current base back.
+static LCDFrame::Frame ws_base;             // written by the egress task only
+static uint16_t ws_seq = 0;
+static bool ws_have_base = false;
+static portMUX_TYPE ws_mux = portMUX_INITIALIZER_UNLOCKED;
+static std::atomic<uint32_t> stat_ws_full{0}, stat_ws_delta{0}, stat_ws_bytes{0}, stat_ws_keyreq{0};
 
-  JsonObject cur = doc.createNestedObject("cursor");
-  cur["r"] = st.cursor_row;
-  cur["c"] = st.cursor_col;
+// ---- SSE per-client pacing ----
+// The egress task sends to each /emu/events client on its own, not with sse.send() to
+// all: a phone in the background or on a weak link would otherwise grow its queue in the
+// async server until messages drop or the heap runs short. A client gets a frame only
+// when its queue is empty and WEB_EMU_SSE_MIN_INTERVAL_MS has passed since its last one.
+// Otherwise it is owed the newest frame; a newer frame supersedes the owed one (counted
+// in 'dropped'), so at most one frame per client is ever waiting here. A client whose
+// queue has not drained for WEB_EMU_SSE_STALL_MS is closed.
+//
+// The library locks a client's message queue in send(), so the egress task may send, but
+// its queue length and close() are left to the async_tcp task. Each client's ack and poll
+// callbacks are wrapped (sseHook): after the library's own handling they copy the queue
+// length into 'queue', and the poll closes a client the egress task marked 'evict'.
+//
+// Every frame carries an event ID made of a per-boot tag and the generation's low 16 bits
+// (sseId). A client is sent a "delta" event (LCDJson::writeDelta) against the frame it
+// holds while that frame is still in the history of the last WEB_EMU_SSE_HISTORY pushed
+// frames, and a full "message" otherwise. A reconnecting browser presents Last-Event-ID
+// and gets only what changed since, or nothing if it is current.
+struct SseClient {
+  AsyncEventSourceClient* client = nullptr;
+  uint32_t id = 0;
+  uint32_t base_gen = 0;        // generation the client holds
+  bool has_base = false;
+  uint32_t sent_ms = 0;
+  uint32_t busy_ms = 0;         // queue non-empty since (0 = drained at the last look)
+  uint16_t queue = 0;           // messages in the library's queue, as of the last ack/poll
+  bool evict = false;           // stalled: closed at its next poll
+  bool owed = false;            // last_pushed is newer than what it was sent
+  uint32_t sent = 0;
+  uint32_t dropped = 0;
+};
+static SseClient sse_clients[WEB_EMU_SSE_MAX_CLIENTS];
+// Guards sse_clients; taken on the egress task and by the async_tcp callbacks
+static SemaphoreHandle_t sse_lock = nullptr;
+static uint32_t sse_next_id = 1;
+static std::atomic<uint32_t> stat_sse_evicted{0}, stat_sse_rejected{0};
+static std::atomic<uint32_t> stat_sse_full{0}, stat_sse_delta{0}, stat_sse_resumed{0}, stat_sse_resync{0};
 
-  JsonArray rows = doc.createNestedArray("rows");
-  for (int i = 0; i < 4; ++i) {
-    char line[21];
-    memcpy(line, st.rows[i], 20);
-    line[20] = '\0';
-    rows.add(line);
+// Pushed frames, oldest first; written by the egress task, read on connect
+static LCDMonitor::DisplayFrame sse_hist[WEB_EMU_SSE_HISTORY];
+static uint8_t sse_hist_head = 0, sse_hist_count = 0;
+static portMUX_TYPE sse_hist_mux = portMUX_INITIALIZER_UNLOCKED;
+
+// ---- /emu/state conditional GET + long-poll ----
+// ETag is the display generation plus a per-boot tag, so a tag from before a reboot
+// never matches. A request whose If-None-Match matches and carries ?wait=ms gets a
+// LongPollResponse, which answers it on the async_tcp task once the display generation
+// has moved past the client's, or with 304 at its deadline. pushFrame() wakes parked
+// responses through the tcpip thread (lpWake), so they answer within a frame.
+static uint32_t boot_tag = 0;
+static LCDMonitor::DisplayFrame last_pushed;       // egress task only
+static std::atomic<uint32_t> stat_full{0}, stat_not_modified{0}, stat_parked{0};
+static std::atomic<uint32_t> stat_woken{0}, stat_expired{0}, stat_rejected{0};
+static std::atomic<uint32_t> lp_waiting{0};        // LongPollResponses not yet decided
+
+// Parked long-polls: the connection's AsyncClient and lwIP pcb, set on the async_tcp task
+// when a response parks and cleared when it decides or is freed
+struct LpSlot {
+  const void* owner = nullptr;
+  AsyncClient* client = nullptr;
+  tcp_pcb* pcb = nullptr;
+};
+static LpSlot lp_slots[WEB_EMU_MAX_WAITERS];
+static portMUX_TYPE lp_mux = portMUX_INITIALIZER_UNLOCKED;
+static std::atomic<bool> lp_wake_queued{false};    // one lpWake in the tcpip mailbox at most
+
+static void makeEtag(uint32_t gen, char* out, size_t cap) {
+  snprintf(out, cap, "\"%08lx-%lu\"", (unsigned long)boot_tag, (unsigned long)gen);
+}
+
+static bool etagMatches(AsyncWebServerRequest* req, const char* etag) {
+  if (!req->hasHeader("If-None-Match")) return false;
+  const String inm = req->header("If-None-Match");
+  return inm == "*" || inm.indexOf(etag) >= 0;
+}
+
+// no-cache: browsers may store the body but must revalidate (cheap 304) every time
+static void sendState(AsyncWebServerRequest* req, const LCDMonitor::DisplayFrame& st) {
+  char js[LCDJson::kMaxSize];
+  char etag[24];
+  FrameCache::json(st, js, sizeof(js));
+  makeEtag(st.generation, etag, sizeof(etag));
+  auto* res = req->beginResponse(200, "application/json", js);
+  res->addHeader("ETag", etag);
+  res->addHeader("Cache-Control", "no-cache");
+  req->send(res);
+  stat_full.fetch_add(1, std::memory_order_relaxed);
+}
+
+static void sendNotModified(AsyncWebServerRequest* req, uint32_t gen) {
+  char etag[24];
+  makeEtag(gen, etag, sizeof(etag));
+  auto* res = req->beginResponse(304);
+  res->addHeader("ETag", etag);
+  res->addHeader("Cache-Control", "no-cache");
+  req->send(res);
+  stat_not_modified.fetch_add(1, std::memory_order_relaxed);
+}
+
+// Kept below 2^31: the async server parses Last-Event-ID with atoi()
+static uint32_t sseId(uint32_t gen) {
+  return ((boot_tag & 0x7FFF) | 1) << 16 | (gen & 0xFFFF);
+}
+
+static void histPush(const LCDMonitor::DisplayFrame& st) {
+  portENTER_CRITICAL(&sse_hist_mux);
+  if (sse_hist_count == WEB_EMU_SSE_HISTORY) {
+    sse_hist_head = (sse_hist_head + 1) % WEB_EMU_SSE_HISTORY;
+    sse_hist_count--;
   }
+  sse_hist[(sse_hist_head + sse_hist_count) % WEB_EMU_SSE_HISTORY] = st;
+  sse_hist_count++;
+  portEXIT_CRITICAL(&sse_hist_mux);
+}
 
-  String out;
-  serializeJson(doc, out);
-  return out;
+// Newest history frame whose generation (or, with 'by_id', whose sseId) matches 'key'
+static bool histFind(uint32_t key, bool by_id, LCDMonitor::DisplayFrame& out) {
+  bool found = false;
+  portENTER_CRITICAL(&sse_hist_mux);
+  for (int i = sse_hist_count - 1; i >= 0 && !found; --i) {
+    const LCDMonitor::DisplayFrame& f = sse_hist[(sse_hist_head + i) % WEB_EMU_SSE_HISTORY];
+    if ((by_id ? sseId(f.generation) : f.generation) == key) {
+      out = f;
+      found = true;
+    }
+  }
+  portEXIT_CRITICAL(&sse_hist_mux);
+  return found;
 }
 
-void begin() {
-  // NOTE: WiFiMgr::getServer() must be declared in wifimgr.h
-  AsyncWebServer& server = WiFiMgr::getServer();
+static bool histNewest(LCDMonitor::DisplayFrame& out) {
+  portENTER_CRITICAL(&sse_hist_mux);
+  const bool have = sse_hist_count > 0;
+  if (have) out = sse_hist[(sse_hist_head + sse_hist_count - 1) % WEB_EMU_SSE_HISTORY];
+  portEXIT_CRITICAL(&sse_hist_mux);
+  return have;
+}
 
-  // Allow cross-origin access for Electron / file:// or other hosts.
-  DefaultHeaders::Instance().addHeader("Access-Control-Allow-Origin", "*");
+static void lpPark(const void* owner, AsyncClient* client) {
+  if (!client) return;
+  portENTER_CRITICAL(&lp_mux);
+  for (LpSlot& s : lp_slots) {
+    if (s.owner) continue;
+    s.owner = owner;
+    s.client = client;
+    s.pcb = client->pcb();
+    break;
+  }
+  portEXIT_CRITICAL(&lp_mux);
+}
 
-  // ---- HTML UI ----
-  server.on("/emu", HTTP_GET, [](AsyncWebServerRequest* req){
-    static const char* kHtml = R"HTML(<!doctype html><html><head>
-<meta charset="utf-8"/>
-<meta name="viewport" content="width=device-width,initial-scale=1"/>
-<title>Theia Web Emulator</title>
-<style>
-  :root{--bg:#0b0b0b;--panel:#151515;--text:#e9e9e9;--muted:#9aa0a6;--grid:#222;}
-  body{margin:0;background:var(--bg);color:var(--text);font:14px/1.4 ui-monospace, SFMono-Regular, Menlo, Consolas, monospace;}
-  .wrap{max-width:880px;margin:24px auto;padding:0 16px;}
-  .card{background:var(--panel);border-radius:14px;box-shadow:0 8px 24px rgba(0,0,0,.35);padding:16px 16px 18px;}
-  h1{margin:0 0 12px;font:600 18px system-ui,Segoe UI,Roboto,Helvetica,Arial;}
-  .lcd{display:grid;grid-template-columns:repeat(20,1fr);gap:4px;background:var(--grid);padding:10px;border-radius:10px;}
-  .row{display:grid;grid-template-columns:repeat(20,1fr);gap:4px;margin-bottom:4px}
-  .cell{background:#0f172a;border-radius:6px;padding:6px 4px;min-width:10px;text-align:center;white-space:pre;color:#cbd5e1}
-  .meta{display:flex;gap:16px;color:var(--muted);margin:10px 0 0;flex-wrap:wrap}
-  .pill{background:#111;border:1px solid #2a2a2a;border-radius:999px;padding:2px 8px}
-  .bar{height:4px;border-radius:999px;background:linear-gradient(90deg,#22c55e,#06b6d4);opacity:.6;margin:8px 0}
-  .nodata{text-align:center;color:#bbb;font-size:1em;margin:24px 0;}
-  a{color:#7dd3fc;text-decoration:none}
-</style>
-</head><body>
-<div class="wrap">
-  <div class="card">
-    <h1>Theia Web Emulator</h1>
-    <div id="lcd"></div>
-    <div id="nodata" class="nodata">⚠ No data detected — enable OLED support on your Xbox.</div>
-    <div class="bar"></div>
-    <div class="meta">
-      <div class="pill"><strong>disp</strong>: <span id="mdisp">?</span></div>
-      <div class="pill"><strong>cursor</strong>: <span id="mcur">?</span></div>
-      <div class="pill"><strong>blink</strong>: <span id="mblink">?</span></div>
-      <div class="pill"><strong>cursor@</strong>: <span id="mpos">0,0</span></div>
-      <div class="pill"><a href="/emu/state" target="_blank">/emu/state</a></div>
-    </div>
-  </div>
-</div>
-<script>
-  const lcd=document.getElementById('lcd');
-  const msg=document.getElementById('nodata');
-  const mdisp=document.getElementById('mdisp');
-  const mcur=document.getElementById('mcur');
-  const mblink=document.getElementById('mblink');
-  const mpos=document.getElementById('mpos');
-  let haveData=false;
-
-  function render(rows){
-    lcd.innerHTML='';
-    for(let r=0;r<4;r++){
-      const row=document.createElement('div'); row.className='row';
-      const txt=(rows[r]||'').padEnd(20,' ').slice(0,20);
-      for(let c=0;c<20;c++){
-        const d=document.createElement('div'); d.className='cell';
-        d.textContent = txt[c];
-        row.appendChild(d);
-      }
-      lcd.appendChild(row);
+static void lpUnpark(const void* owner) {
+  portENTER_CRITICAL(&lp_mux);
+  for (LpSlot& s : lp_slots) {
+    if (s.owner == owner) s = LpSlot();
+  }
+  portEXIT_CRITICAL(&lp_mux);
+}
+
+// Runs on the tcpip thread (tcpip_callback from pushFrame). Fires each parked connection's
+// lwIP poll callback, as the 500 ms poll timer would: AsyncTCP queues the poll to the
+// async_tcp task, where the request calls LongPollResponse::_ack(). Nothing of the request
+// is touched here. A slot can go stale between the copy and the loop, so only a pcb lwIP
+// still has active and still bound to the same AsyncClient is polled; lwIP frees pcbs on
+// this thread only, so the check holds while the callback runs.
+static void lpWake(void*) {
+  lp_wake_queued.store(false);
+  LpSlot slots[WEB_EMU_MAX_WAITERS];
+  portENTER_CRITICAL(&lp_mux);
+  for (int i = 0; i < WEB_EMU_MAX_WAITERS; ++i) slots[i] = lp_slots[i];
+  portEXIT_CRITICAL(&lp_mux);
+  for (const LpSlot& s : slots) {
+    if (!s.pcb) continue;
+    for (tcp_pcb* p = tcp_active_pcbs; p; p = p->next) {
+      if (p != s.pcb) continue;
+      if (p->callback_arg == s.client && p->poll) p->poll(p->callback_arg, p);
+      break;
     }
   }
+}
+
+// A parked /emu/state long-poll. AsyncWebServerRequest is not safe to touch from another
+// task, so nothing outside the request's own callbacks does: the server calls _ack() on
+// every ACK and on every connection poll while the response is unfinished, all on the
+// async_tcp task. Polls come every 500 ms, and right after each pushFrame() (lpWake).
+// The status line and headers are built only once the outcome is known, so the reply
+// carries the matching ETag: 200 with the current frame once its generation is newer than
+// the client's, 304 at the deadline. A dropped connection simply frees the request and
+// this response with it.
+class LongPollResponse : public AsyncAbstractResponse {
+public:
+  LongPollResponse(uint32_t gen, uint32_t wait_ms) : gen_(gen), deadline_ms_(millis() + wait_ms) {
+    lp_waiting.fetch_add(1, std::memory_order_relaxed);
+  }
+  ~LongPollResponse() override {
+    if (decided_) return;
+    lpUnpark(this);
+    lp_waiting.fetch_sub(1, std::memory_order_relaxed);
+  }
+
+  bool _sourceValid() const override { return true; }
+
+  // Maybe already answerable (the screen changed since the snapshot); else park for lpWake
+  void _respond(AsyncWebServerRequest* req) override {
+    _ack(req, 0, 0);
+    if (!decided_) lpPark(this, req->client());
+  }
+
+  size_t _ack(AsyncWebServerRequest* req, size_t len, uint32_t time) override {
+    if (decided_) return AsyncAbstractResponse::_ack(req, len, time);
+    if (!decide()) return 0;
+    AsyncAbstractResponse::_respond(req);     // head + body from here on
+    return 0;
+  }
+
+  size_t _fillBuffer(uint8_t* buf, size_t maxLen) override {
+    const size_t n = min(maxLen, len_ - off_);
+    memcpy(buf, body_ + off_, n);
+    off_ += n;
+    return n;
+  }
 
-  function apply(state){
-    if(!state) return;
-    haveData=true;
-    msg.style.display='none';
-    render(state.rows||[]);
-    mdisp.textContent = state.disp ? 'on' : 'off';
-    mcur.textContent  = state.cur ? 'on' : 'off';
-    mblink.textContent= state.blink ? 'on' : 'off';
-    if(state.cursor && typeof state.cursor.r==='number' && typeof state.cursor.c==='number'){
-      mpos.textContent = state.cursor.r + ',' + state.cursor.c;
+private:
+  bool decide() {
+    char etag[24];
+    LCDMonitor::DisplayFrame f;
+    LCDMonitor::getSnapshot(f);
+    if ((int32_t)(f.generation - gen_) > 0) {
+      len_ = FrameCache::json(f, body_, sizeof(body_));
+      makeEtag(f.generation, etag, sizeof(etag));
+      setCode(200);
+      setContentType("application/json");
+      setContentLength(len_);
+      stat_woken.fetch_add(1, std::memory_order_relaxed);
+      stat_full.fetch_add(1, std::memory_order_relaxed);
+    } else if ((int32_t)(millis() - deadline_ms_) >= 0) {
+      makeEtag(gen_, etag, sizeof(etag));
+      setCode(304);
+      setContentLength(0);
+      stat_expired.fetch_add(1, std::memory_order_relaxed);
+      stat_not_modified.fetch_add(1, std::memory_order_relaxed);
+    } else {
+      return false;
     }
+    addHeader("ETag", etag);
+    addHeader("Cache-Control", "no-cache");
+    decided_ = true;
+    lpUnpark(this);
+    lp_waiting.fetch_sub(1, std::memory_order_relaxed);
+    return true;
   }
 
-  // Initial fetch
-  fetch('/emu/state',{cache:'no-store'}).then(r=>r.json()).then(j=>{
-    if(j && j.rows && j.rows.length>0 && j.rows.some(line=>line.trim()!=="")) apply(j);
-  }).catch(()=>{});
+  uint32_t gen_;
+  uint32_t deadline_ms_;
+  bool decided_ = false;
+  char body_[LCDJson::kMaxSize];
+  size_t len_ = 0;
+  size_t off_ = 0;
+};
 
-  // Live updates via SSE
-  const es = new EventSource('/emu/events');
-  es.addEventListener('message', e => {
-    try { apply(JSON.parse(e.data)); } catch(_){}
-  });
+// One frame on its way to the SSE clients. The full JSON and the delta are built on first
+// use; clients holding the same base share the delta.
+struct SseOut {
+  const LCDMonitor::DisplayFrame& frame;
+  char full[LCDJson::kMaxSize];
+  size_t full_len = 0;
+  char delta[LCDJson::kMaxSize];
+  size_t delta_len = 0;
+  uint32_t delta_base = 0;
+  bool delta_tried = false;
 
-  // If no data after 10s, show message (already visible by default)
-  setTimeout(()=>{ if(!haveData) msg.style.display='block'; },10000);
-</script>
-</body></html>)HTML";
+  explicit SseOut(const LCDMonitor::DisplayFrame& f) : frame(f) {}
 
-    auto* res = req->beginResponse(200, "text/html; charset=utf-8", kHtml);
-    res->addHeader("Cache-Control", "no-store");
-    req->send(res);
-  });
+  const char* fullJson() {
+    if (!full_len) full_len = FrameCache::json(frame, full, sizeof(full));
+    return full_len ? full : nullptr;
+  }
+
+  // Delta from 'base_gen' if that frame is still in the history and the delta is smaller
+  const char* deltaFrom(uint32_t base_gen) {
+    if (delta_tried && delta_base == base_gen) return delta_len ? delta : nullptr;
+    delta_tried = true;
+    delta_base = base_gen;
+    delta_len = 0;
+    LCDMonitor::DisplayFrame base;
+    if (histFind(base_gen, false, base) && fullJson()) {
+      LCDFrame::Frame a, b;
+      FrameCache::toFrame(base, a);
+      FrameCache::toFrame(frame, b);
+      delta_len = LCDJson::writeDelta(delta, sizeof(delta), frame.generation, base_gen, a, b);
+      if (delta_len >= full_len) delta_len = 0;
+    }
+    return delta_len ? delta : nullptr;
+  }
+};
+
+// Bring 'c' to out.frame: a delta from what it holds, else the full frame. Caller holds sse_lock.
+static void sseSendFrame(SseClient& c, SseOut& out) {
+  const uint32_t gen = out.frame.generation;
+  if (c.has_base && c.base_gen == gen) return;
+  const char* delta = c.has_base ? out.deltaFrom(c.base_gen) : nullptr;
+  if (delta) {
+    c.client->send(delta, "delta", sseId(gen));
+    stat_sse_delta.fetch_add(1, std::memory_order_relaxed);
+  } else {
+    const char* full = out.fullJson();
+    if (!full) return;
+    c.client->send(full, "message", sseId(gen));
+    stat_sse_full.fetch_add(1, std::memory_order_relaxed);
+  }
+  c.queue++;                    // busy until an ack or poll says it drained
+  c.base_gen = gen;
+  c.has_base = true;
+}
+
+// Send 'out' to 'c' if its queue is empty and its interval has passed. Caller holds sse_lock.
+static bool sseTrySend(SseClient& c, SseOut& out, uint32_t now) {
+  if (c.queue) {
+    if (!c.busy_ms) c.busy_ms = now ? now : 1;
+    return false;
+  }
+  c.busy_ms = 0;
+  if (c.sent && now - c.sent_ms < WEB_EMU_SSE_MIN_INTERVAL_MS) return false;
+  sseSendFrame(c, out);
+  c.sent_ms = now;
+  c.sent++;
+  c.owed = false;
+  return true;
+}
+
+// On the async_tcp task, after the library's ack or poll handling: note the client's queue
+// length. Returns true when the client was marked for eviction.
+static bool sseSample(AsyncEventSourceClient* client) {
+  bool evict = false;
+  xSemaphoreTakeRecursive(sse_lock, portMAX_DELAY);
+  for (SseClient& c : sse_clients) {
+    if (c.client != client) continue;
+    c.queue = (uint16_t)client->packetsWaiting();
+    evict = c.evict;
+  }
+  xSemaphoreGiveRecursive(sse_lock);
+  return evict;
+}
+
+// Wrap the library's ack and poll callbacks of a newly connected client
+static void sseHook(AsyncEventSourceClient* client) {
+  AsyncClient* tcp = client->client();
+  if (!tcp) return;
+  tcp->onAck([](void* arg, AsyncClient*, size_t len, uint32_t time){
+    AsyncEventSourceClient* c = (AsyncEventSourceClient*)arg;
+    c->_onAck(len, time);
+    sseSample(c);
+  }, client);
+  tcp->onPoll([](void* arg, AsyncClient*){
+    AsyncEventSourceClient* c = (AsyncEventSourceClient*)arg;
+    if (sseSample(c)) {
+      c->close();               // frees the client; the disconnect hook clears the slot
+      return;
+    }
+    c->_onPoll();
+    sseSample(c);
+  }, client);
+}
+
+// Keyframe of the frame the next delta applies to
+static size_t wsKeyframe(uint8_t* out, size_t cap) {
+  LCDFrame::Frame f;
+  uint16_t seq;
+  bool have;
+  portENTER_CRITICAL(&ws_mux);
+  f = ws_base;
+  seq = ws_seq;
+  have = ws_have_base;
+  portEXIT_CRITICAL(&ws_mux);
+  if (!have) {
+    // Nothing pushed yet: the first push is a keyframe anyway
+    LCDMonitor::DisplayFrame st;
+    LCDMonitor::getSnapshot(st);
+    FrameCache::toFrame(st, f);
+  }
+  return LCDFrame::encodeFull(out, cap, seq, f);
+}
+
+static void wsPush(const LCDMonitor::DisplayFrame& st) {
+  LCDFrame::Frame f;
+  FrameCache::toFrame(st, f);
+  const uint16_t seq = (uint16_t)(ws_seq + 1);
+  const size_t clients = ws.count();
+  uint8_t buf[LCDFrame::kMaxPacket];
+  size_t len = 0;
+  if (clients) {
+    if (ws_have_base) len = LCDFrame::encodeDelta(buf, sizeof(buf), seq, ws_seq, ws_base, f);
+    if (len) {
+      stat_ws_delta.fetch_add(1, std::memory_order_relaxed);
+    } else {
+      len = LCDFrame::encodeFull(buf, sizeof(buf), seq, f);
+      stat_ws_full.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+  // The base moves on even with no clients, so a keyframe for a new one is current
+  portENTER_CRITICAL(&ws_mux);
+  ws_base = f;
+  ws_seq = seq;
+  ws_have_base = true;
+  portEXIT_CRITICAL(&ws_mux);
+  if (len) {
+    ws.binaryAll(buf, len);
+    stat_ws_bytes.fetch_add(len * clients, std::memory_order_relaxed);
+  }
+}
+
+void begin() {
+  sse_lock = xSemaphoreCreateRecursiveMutex();
+  boot_tag = esp_random();
+
+  // NOTE: WiFiMgr::getServer() must be declared in wifimgr.h
+  AsyncWebServer& server = WiFiMgr::getServer();
+
+  // Allow cross-origin access for Electron / file:// or other hosts.
+  DefaultHeaders::Instance().addHeader("Access-Control-Allow-Origin", "*");
+
+  // The /emu page itself (web/emu.html + /a/emu.*.css/js) is a static asset that
+  // WiFiMgr registers with WebAssets::begin().
 
   // ---- JSON state ----
+  // GET /emu/state[?wait=ms]: 304 when If-None-Match holds the current ETag; with
+  // ?wait, hold the request until the screen changes or the wait runs out
   server.on("/emu/state", HTTP_GET, [](AsyncWebServerRequest* req){
-    const auto& st = LCDMonitor::getDisplayState();
-    String js = buildStateJson(st);
-    auto* res = req->beginResponse(200, "application/json", js);
-    res->addHeader("Cache-Control", "no-store");
-    req->send(res);
+    LCDMonitor::DisplayFrame st;
+    LCDMonitor::getSnapshot(st);
+    char etag[24];
+    makeEtag(st.generation, etag, sizeof(etag));
+    if (!etagMatches(req, etag)) {
+      sendState(req, st);
+      return;
+    }
+    if (req->hasParam("wait")) {
+      const long wait = req->getParam("wait")->value().toInt();
+      if (wait > 0) {
+        // Over the limit: 304 at once, the client simply polls again
+        if (lp_waiting.load(std::memory_order_relaxed) < WEB_EMU_MAX_WAITERS) {
+          stat_parked.fetch_add(1, std::memory_order_relaxed);
+          req->send(new LongPollResponse(st.generation, (uint32_t)min<long>(wait, WEB_EMU_MAX_WAIT_MS)));
+          return;
+        }
+        stat_rejected.fetch_add(1, std::memory_order_relaxed);
+      }
+    }
+    sendNotModified(req, st.generation);
   });
 
   // ---- SSE stream ----
   sse.onConnect([](AsyncEventSourceClient* client){
-    // Lower reconnection delay for snappy resume (ms)
-    client->send("", "", millis(), 1500);
-    // Send an immediate snapshot so UI renders without waiting for the next I2C update
-    const auto& st = LCDMonitor::getDisplayState();
-    String js = buildStateJson(st);
-    client->send(js.c_str(), "message");
+    xSemaphoreTakeRecursive(sse_lock, portMAX_DELAY);
+    SseClient* slot = nullptr;
+    for (SseClient& c : sse_clients) {
+      if (!c.client) { slot = &c; break; }
+    }
+    if (!slot) {
+      xSemaphoreGiveRecursive(sse_lock);
+      stat_sse_rejected.fetch_add(1, std::memory_order_relaxed);
+      client->close();
+      return;
+    }
+    *slot = SseClient();
+    slot->client = client;
+    slot->id = sse_next_id++;
+    sseHook(client);
+    // Lower reconnection delay for snappy resume (ms). No ID: it would replace the
+    // browser's Last-Event-ID.
+    client->send("", "", 0, 1500);
+
+    // Send the newest frame right away so the UI renders without waiting for the next
+    // I2C update: only the changes if Last-Event-ID names a frame we still have
+    LCDMonitor::DisplayFrame cur;
+    if (histNewest(cur)) {
+      LCDMonitor::DisplayFrame base;
+      const uint32_t last = client->lastId();
+      if (last && histFind(last, true, base)) {
+        slot->base_gen = base.generation;
+        slot->has_base = true;
+        stat_sse_resumed.fetch_add(1, std::memory_order_relaxed);
+      } else if (last) {
+        stat_sse_resync.fetch_add(1, std::memory_order_relaxed);
+      }
+      SseOut out(cur);
+      sseSendFrame(*slot, out);
+    } else {
+      // Nothing pushed yet: a snapshot. It is not in the history, so the next frame goes whole.
+      LCDMonitor::DisplayFrame st;
+      LCDMonitor::getSnapshot(st);
+      char js[LCDJson::kMaxSize];
+      if (FrameCache::json(st, js, sizeof(js))) client->send(js, "message", sseId(st.generation));
+    }
+    slot->sent_ms = millis();
+    slot->sent = 1;
+    xSemaphoreGiveRecursive(sse_lock);
+  });
+  sse.onDisconnect([](AsyncEventSourceClient* client){
+    xSemaphoreTakeRecursive(sse_lock, portMAX_DELAY);
+    for (SseClient& c : sse_clients) if (c.client == client) c.client = nullptr;
+    xSemaphoreGiveRecursive(sse_lock);
   });
 
   server.addHandler(&sse);
+
+  // ---- WebSocket stream ----
+  ws.onEvent([](AsyncWebSocket*, AsyncWebSocketClient* client, AwsEventType type, void*, uint8_t*, size_t){
+    if (type == WS_EVT_CONNECT) {
+      ws.cleanupClients(WEB_EMU_WS_MAX_CLIENTS);    // closes the oldest beyond the cap
+    } else if (type == WS_EVT_DATA) {
+      stat_ws_keyreq.fetch_add(1, std::memory_order_relaxed);
+    } else {
+      return;
+    }
+    uint8_t buf[LCDFrame::kMaxPacket];
+    const size_t len = wsKeyframe(buf, sizeof(buf));
+    if (len) client->binary(buf, len);
+  });
+  server.addHandler(&ws);
 }
 
-void loop() {
-  const auto& st = LCDMonitor::getDisplayState();
+void pushFrame(const LCDMonitor::DisplayFrame& st) {
+  const uint32_t now = millis();
+  histPush(st);
+  SseOut out(st);
+  xSemaphoreTakeRecursive(sse_lock, portMAX_DELAY);
+  for (SseClient& c : sse_clients) {
+    if (!c.client || c.evict) continue;
+    if (c.owed) c.dropped++;      // the frame it was owed never went out
+    c.owed = true;
+    sseTrySend(c, out, now);
+  }
+  xSemaphoreGiveRecursive(sse_lock);
+  wsPush(st);
+  last_pushed = st;
+  if (lp_waiting.load(std::memory_order_relaxed) && !lp_wake_queued.exchange(true)) {
+    if (tcpip_callback(lpWake, nullptr) != ERR_OK) lp_wake_queued.store(false);
+  }
+}
 
-  // Send on state change
-  if (st.last_update_ms != last_sent_ms) {
-    last_sent_ms = st.last_update_ms;
-    const String json = buildStateJson(st);
-    sse.send(json.c_str(), "message");
-    last_ka_ms = millis(); // reset keep-alive timer after a real update
-    return;
+// Owed SSE frames and stalled clients. Returns ms until a client should be looked at again.
+static uint32_t serviceSse(uint32_t now) {
+  uint32_t next_ms = 0;
+  SseOut out(last_pushed);
+  xSemaphoreTakeRecursive(sse_lock, portMAX_DELAY);
+  for (SseClient& c : sse_clients) {
+    if (!c.client || c.evict) continue;
+    const bool busy = c.queue > 0;
+    if (!busy) c.busy_ms = 0;
+    else if (!c.busy_ms) c.busy_ms = now ? now : 1;
+    if (busy && now - c.busy_ms >= WEB_EMU_SSE_STALL_MS) {
+      Serial.printf("[WebEmu] SSE client %u stalled, closing\n", (unsigned)c.id);
+      c.evict = true;           // closed by its poll callback on async_tcp
+      stat_sse_evicted.fetch_add(1, std::memory_order_relaxed);
+      continue;
+    }
+    if (c.owed && !busy && sseTrySend(c, out, now)) continue;
+    if (!c.owed && !busy) continue;
+    // Owed and busy: poll the queue. Busy only: look again at the stall deadline.
+    // Owed and idle: until its interval ends.
+    uint32_t wait;
+    if (busy) {
+      wait = c.owed ? WEB_EMU_SSE_POLL_MS : WEB_EMU_SSE_STALL_MS - (now - c.busy_ms);
+    } else {
+      const uint32_t since = now - c.sent_ms;
+      wait = since >= WEB_EMU_SSE_MIN_INTERVAL_MS ? 1 : WEB_EMU_SSE_MIN_INTERVAL_MS - since;
+    }
+    if (!next_ms || wait < next_ms) next_ms = wait;
   }
+  xSemaphoreGiveRecursive(sse_lock);
+  return next_ms;
+}
 
-  // Keep-alive every ~15s so webviews never stall even if LCD is quiet
-  const uint32_t now = millis();
-  if (now - last_ka_ms > 15000) {
-    // Event name 'ka' with empty payload; browsers ignore it but keep the stream fresh
-    sse.send("", "ka");
-    last_ka_ms = now;
+uint32_t service(uint32_t now) {
+  if (!sse_lock) return 0;
+  return serviceSse(now);
+}
+
+SseStats getSseStats() {
+  SseStats st;
+  st.evicted = stat_sse_evicted.load(std::memory_order_relaxed);
+  st.rejected = stat_sse_rejected.load(std::memory_order_relaxed);
+  st.full = stat_sse_full.load(std::memory_order_relaxed);
+  st.delta = stat_sse_delta.load(std::memory_order_relaxed);
+  st.resumed = stat_sse_resumed.load(std::memory_order_relaxed);
+  st.resync = stat_sse_resync.load(std::memory_order_relaxed);
+  if (!sse_lock) return st;
+  xSemaphoreTakeRecursive(sse_lock, portMAX_DELAY);
+  for (const SseClient& c : sse_clients) {
+    if (!c.client) continue;
+    SseStats::Client& o = st.clients[st.count++];
+    o.id = c.id;
+    o.queue = c.queue;
+    o.sent = c.sent;
+    o.dropped = c.dropped;
+    o.owed = c.owed;
   }
+  xSemaphoreGiveRecursive(sse_lock);
+  return st;
+}
+
+WsStats getWsStats() {
+  WsStats st;
+  st.clients = (uint8_t)ws.count();
+  st.full = stat_ws_full.load(std::memory_order_relaxed);
+  st.delta = stat_ws_delta.load(std::memory_order_relaxed);
+  st.bytes = stat_ws_bytes.load(std::memory_order_relaxed);
+  st.keyreq = stat_ws_keyreq.load(std::memory_order_relaxed);
+  return st;
+}
+
+StateStats getStateStats() {
+  StateStats st;
+  st.waiting = (uint8_t)lp_waiting.load(std::memory_order_relaxed);
+  st.full = stat_full.load(std::memory_order_relaxed);
+  st.not_modified = stat_not_modified.load(std::memory_order_relaxed);
+  st.parked = stat_parked.load(std::memory_order_relaxed);
+  st.woken = stat_woken.load(std::memory_order_relaxed);
+  st.expired = stat_expired.load(std::memory_order_relaxed);
+  st.rejected = stat_rejected.load(std::memory_order_relaxed);
+  return st;
+}
+
+void keepAlive() {
+  // Event name 'ka' with empty payload; browsers ignore it but keep the stream fresh
+  sse.send("", "ka");
 }
 
 } // namespace WebEmu
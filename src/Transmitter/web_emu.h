@@ -1,12 +1,99 @@
 #pragma once
 #include <Arduino.h>
+#include "lcd_monitor.h"
+
+// /emu/state long-polls (?wait=ms) held at once, and the longest wait honoured
+#ifndef WEB_EMU_MAX_WAITERS
+#define WEB_EMU_MAX_WAITERS 4
+#endif
+#ifndef WEB_EMU_MAX_WAIT_MS
+#define WEB_EMU_MAX_WAIT_MS 30000
+#endif
+
+// WebSocket viewers (/emu/ws); the oldest is closed when another connects beyond this
+#ifndef WEB_EMU_WS_MAX_CLIENTS
+#define WEB_EMU_WS_MAX_CLIENTS 4
+#endif
+
+// SSE viewers (/emu/events): how many are served, the fastest each one is sent frames,
+// how often a busy client's queue is re-checked, and how long a queue may stay non-empty
+// before the client is closed
+#ifndef WEB_EMU_SSE_MAX_CLIENTS
+#define WEB_EMU_SSE_MAX_CLIENTS 4
+#endif
+#ifndef WEB_EMU_SSE_MIN_INTERVAL_MS
+#define WEB_EMU_SSE_MIN_INTERVAL_MS 100
+#endif
+#ifndef WEB_EMU_SSE_POLL_MS
+#define WEB_EMU_SSE_POLL_MS 50
+#endif
+#ifndef WEB_EMU_SSE_STALL_MS
+#define WEB_EMU_SSE_STALL_MS 10000
+#endif
+// Pushed frames kept for SSE deltas and Last-Event-ID resume
+#ifndef WEB_EMU_SSE_HISTORY
+#define WEB_EMU_SSE_HISTORY 16
+#endif
 
 namespace WebEmu {
 
+// /emu/events clients
+struct SseStats {
+  struct Client {
+    uint32_t id = 0;          // per connection, counting from 1 since boot
+    uint16_t queue = 0;       // messages waiting in the async server (as of its last ack/poll)
+    uint32_t sent = 0;        // frames sent
+    uint32_t dropped = 0;     // frames superseded before they could be sent
+    bool owed = false;        // a newer frame is waiting for the queue or interval
+  };
+  Client clients[WEB_EMU_SSE_MAX_CLIENTS];
+  uint8_t count = 0;
+  uint32_t evicted = 0;       // closed after stalling
+  uint32_t rejected = 0;      // closed on connect: every slot taken
+  uint32_t full = 0;          // "message" events (whole frame)
+  uint32_t delta = 0;         // "delta" events
+  uint32_t resumed = 0;       // connects whose Last-Event-ID was still in the history
+  uint32_t resync = 0;        // connects whose Last-Event-ID was too old (sent whole)
+};
+
+// /emu/ws counters
+struct WsStats {
+  uint8_t  clients = 0;
+  uint32_t full = 0;          // keyframes pushed to all clients
+  uint32_t delta = 0;         // deltas pushed to all clients
+  uint32_t bytes = 0;         // pushed bytes, summed over clients
+  uint32_t keyreq = 0;        // keyframes a page asked for
+};
+
+// /emu/state counters
+struct StateStats {
+  uint32_t full = 0;          // 200 responses
+  uint32_t not_modified = 0;  // 304 responses (immediate or at the wait deadline)
+  uint32_t parked = 0;        // long-polls held
+  uint32_t woken = 0;         // long-polls answered by a new frame
+  uint32_t expired = 0;       // long-polls answered 304 at their deadline
+  uint32_t rejected = 0;      // long-polls answered 304 at once: no free slot
+  uint8_t  waiting = 0;       // held right now
+};
+
 // Start the web UI & endpoints. Call after WiFiMgr::begin().
 void begin();
 
-// Call regularly (e.g., from loop) to broadcast updates when LCD state changes.
-void loop();
+// Push one frame to every SSE and WebSocket client. Called from the network egress task
+// on each new display generation (see net_egress.h).
+void pushFrame(const LCDMonitor::DisplayFrame& st);
+
+// Deferred work, from the egress task after pushFrame(): SSE clients owed a frame (and
+// stalled ones). Returns ms until something is due again (0 = nothing pending).
+// Parked /emu/state long-polls are not serviced here; pushFrame() wakes them and they
+// answer themselves on the async_tcp task.
+uint32_t service(uint32_t now);
+
+SseStats getSseStats();
+StateStats getStateStats();
+WsStats getWsStats();
+
+// Empty 'ka' event so idle webviews keep the stream open.
+void keepAlive();
 
 } // namespace WebEmu
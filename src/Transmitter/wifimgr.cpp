@@ -8,6 +8,11 @@
 #include "esp_wifi.h"
 #include <Update.h> // For OTA
 #include "lcd_monitor.h" // <-- for emulator enable/disable
+#include "dlog.h"
+#include "net_egress.h"
+#include "frame_cache.h"
+#include "web_emu.h"
+#include "web_assets.h"
 
 static AsyncWebServer server(80);
 namespace WiFiMgr {
@@ -58,13 +63,47 @@ void clearCreds() {
     prefs.end();
 }
 
-static String htmlSwitch(bool on) {
-    String checked = on ? "checked" : "";
-    return String() +
-        "<label class='switch'>"
-        "<input id='emuToggle' type='checkbox' " + checked + " onchange='toggleEmu(this.checked)'>"
-        "<span class='slider round'></span>"
-        "</label>";
+// LCD group transport (multicast/ESP-NOW/PHY rate), kept across reboots
+static void loadTransport() {
+    NetEgress::Transport t;
+    prefs.begin("lcdnet", true);
+    t.multicast = prefs.getBool("mcast", t.multicast);
+    IPAddress group;
+    if (group.fromString(prefs.getString("group", ""))) {
+        for (int i = 0; i < 4; i++) t.group[i] = group[i];
+    }
+    t.ttl = prefs.getUChar("ttl", t.ttl);
+    t.phy_rate_mbps = prefs.getUChar("rate", t.phy_rate_mbps);
+    t.espnow = prefs.getBool("espnow", t.espnow);
+    prefs.end();
+    NetEgress::setTransport(t);
+}
+
+static void saveTransport(const NetEgress::Transport& t) {
+    prefs.begin("lcdnet", false);
+    prefs.putBool("mcast", t.multicast);
+    prefs.putString("group", IPAddress(t.group[0], t.group[1], t.group[2], t.group[3]).toString());
+    prefs.putUChar("ttl", t.ttl);
+    prefs.putUChar("rate", t.phy_rate_mbps);
+    prefs.putBool("espnow", t.espnow);
+    prefs.end();
+}
+
+// Integer query parameter within [lo, hi] into 'out'; 'out' is untouched if it is absent.
+// Anything else (not a number, out of range) answers 400 and returns false.
+static bool intParam(AsyncWebServerRequest* request, const char* name, long lo, long hi, long& out) {
+    if (!request->hasParam(name)) return true;
+    const String& v = request->getParam(name)->value();
+    char* end = nullptr;
+    const long n = strtol(v.c_str(), &end, 10);
+    if (v.length() == 0 || *end != '\0' || n < lo || n > hi) {
+        char msg[64];
+        snprintf(msg, sizeof(msg), "%s must be an integer in %ld..%ld", name, lo, hi);
+        request->send(400, "text/plain", msg);
+        return false;
+    }
+    out = n;
+    return true;
 }
 
 void startPortal() {
@@ -89,221 +128,8 @@ void startPortal() {
     // Allow cross-origin (Electron/file:// webviews)
     DefaultHeaders::Instance().addHeader("Access-Control-Allow-Origin", "*");
 
-    server.on("/", HTTP_GET, [](AsyncWebServerRequest *request){
-        const bool emuOn = LCDMonitor::isEmulatorEnabled();
-        String page = R"rawliteral(
-<!DOCTYPE html>
-<html>
-<head>
-    <title>WiFi Setup</title>
-    <meta name="viewport" content="width=320,initial-scale=1">
-    <style>
-        body {background:#111;color:#EEE;font-family:sans-serif;}
-        .container {max-width:340px;margin:24px auto;background:#222;padding:2em;border-radius:12px;box-shadow:0 0 16px #0008;}
-        input,select,button {width:100%;box-sizing:border-box;margin:.7em 0;padding:.6em;font-size:1.05em;border-radius:8px;border:1px solid #555;background:#111;color:#EEE;}
-        .btn-primary {background:#299a2c;color:white;border-color:#299a2c;}
-        .btn-danger {background:#a22;color:white;border-color:#a22;}
-        .btn-ota {background:#265aa5;color:white;border-color:#265aa5;}
-        .btn-web {background:#3b82f6;color:white;border-color:#3b82f6;}
-        .status {margin-top:1em;font-size:.95em;}
-        label {display:block;margin-top:.5em;margin-bottom:.1em;}
-        .row {display:flex;gap:10px;align-items:center;}
-        .row > * {flex:1;}
-        .pill {display:inline-block;padding:.35em .6em;border-radius:999px;background:#333;border:1px solid #555;font-size:.85em;margin-left:6px;}
-        .switch {position: relative; display: inline-block; width: 52px; height: 28px; vertical-align:middle;}
-        .switch input {opacity: 0; width: 0; height: 0;}
-        .slider {position: absolute; cursor: pointer; top: 0; left: 0; right: 0; bottom: 0; background-color: #555; transition: .2s; border-radius: 28px;}
-        .slider:before {position: absolute; content: ""; height: 22px; width: 22px; left: 3px; bottom: 3px; background-color: white; transition: .2s; border-radius:50%;}
-        input:checked + .slider {background-color: #299a2c;}
-        input:checked + .slider:before {transform: translateX(24px);}
-        .section {margin-top:18px;padding-top:12px;border-top:1px dashed #444;}
-        .small {font-size:.9em;color:#bbb;}
-    </style>
-</head>
-<body>
-    <div class="container">
-        <div style="width:100%;text-align:center;margin-bottom:1em">
-            <span style="font-size:1.6em;font-weight:bold;">Type D OLED Emulator Setup</span>
-        </div>
-
-        <div class="section">
-            <div class="row" style="justify-content:space-between">
-                <div style="flex:unset"><b>LCD Emulator</b><span id="emuState" class="pill">...</span></div>
-                <div style="flex:unset" id="emuSwitchHolder">__EMU_SWITCH__</div>
-            </div>
-            <div class="small">Toggle the US2066 emulator (I²C slave at 0x3C) on/off without reboot. Disabling releases the I²C bus.</div>
-        </div>
-
-        <div class="section">
-            <form id="wifiForm" onsubmit="return false;">
-                <label>WiFi Network</label>
-                <select id="ssidDropdown" style="margin-bottom:1em;">
-                    <option value="">Please select a network</option>
-                </select>
-                <input type="text" id="ssid" placeholder="SSID" style="margin-bottom:1em;">
-                <label>Password</label>
-                <input type="password" id="pass" placeholder="WiFi Password">
-                <div class="row">
-                    <button type="button" onclick="save()" class="btn-primary">Connect & Save</button>
-                    <button type="button" onclick="forget()" class="btn-danger">Forget WiFi</button>
-                </div>
-                <div class="row">
-                    <button type="button" onclick="window.location='/ota'" class="btn-ota">OTA Update</button>
-                    <button type="button" onclick="window.location='/emu'" class="btn-web">Web View</button>
-                </div>
-                <div class="row">
-                    <button type="button" onclick="fetch('/udp/ping',{method:'POST'}).then(r=>r.text()).then(t=>alert(t)).catch(()=>alert('Ping failed'))" class="btn-web">Test UDP Ping</button>
-                </div>
-            </form>
-            <div class="status" id="status">Status: ...</div>
-        </div>
-    </div>
-    <script>
-        function setEmuStateTag(on){
-            const tag = document.getElementById('emuState');
-            tag.textContent = on ? 'ENABLED' : 'DISABLED';
-            tag.style.background = on ? '#164b18' : '#4b1616';
-            tag.style.borderColor = on ? '#299a2c' : '#a22';
-        }
-        function fetchEmuState(){
-            fetch('/lcd/state').then(r=>r.json()).then(j=>{
-                setEmuStateTag(!!j.enabled);
-                const toggle = document.getElementById('emuToggle');
-                if (toggle) toggle.checked = !!j.enabled;
-            }).catch(()=>{});
-        }
-        function toggleEmu(on){
-            fetch(on ? '/lcd/enable' : '/lcd/disable', {method:'POST'})
-                .then(()=>fetchEmuState());
-        }
-
-        function uniq(arr){ return [...new Set(arr.filter(s=>s && s.trim().length))]; }
-        let scanning=false;
-        function scan() {
-            if (scanning) return; scanning=true;
-            fetch('/scan').then(r => r.json()).then(list => {
-                list = uniq(list).sort((a,b)=>a.localeCompare(b));
-                let dropdown = document.getElementById('ssidDropdown');
-                dropdown.innerHTML = '';
-                let defaultOpt = document.createElement('option');
-                defaultOpt.value = '';
-                defaultOpt.text = 'Please select a network';
-                dropdown.appendChild(defaultOpt);
-                list.forEach(ssid => {
-                    let opt = document.createElement('option');
-                    opt.value = ssid;
-                    opt.text = ssid;
-                    dropdown.appendChild(opt);
-                });
-                dropdown.onchange = function() {
-                    document.getElementById('ssid').value = dropdown.value;
-                };
-            }).catch(() => {
-                let dropdown = document.getElementById('ssidDropdown');
-                dropdown.innerHTML = '';
-                let opt = document.createElement('option');
-                opt.value = '';
-                opt.text = 'Scan failed';
-                dropdown.appendChild(opt);
-            }).finally(()=>{ scanning=false; });
-        }
-        setInterval(scan, 3000);
-        window.onload = function(){
-            scan();
-            fetchEmuState();
-        };
-        function save() {
-            let ssid = document.getElementById('ssid').value;
-            let pass = document.getElementById('pass').value;
-            fetch('/save', {
-                method: 'POST',
-                headers: {'Content-Type': 'application/json'},
-                body: JSON.stringify({ssid:ssid,pass:pass})
-            }).then(r => r.text()).then(t => {
-                document.getElementById('status').innerText = t;
-            });
-        }
-        function forget() {
-            fetch('/forget').then(r => r.text()).then(t => {
-                document.getElementById('status').innerText = t;
-                document.getElementById('ssid').value = '';
-                document.getElementById('pass').value = '';
-            });
-        }
-        document.getElementById('emuSwitchHolder').innerHTML = `)rawliteral";
-        page += htmlSwitch(emuOn);
-        page += R"rawliteral(`.replace('__EMU_SWITCH__','');
-    </script>
-</body>
-</html>
-        )rawliteral";
-        request->send(200, "text/html", page);
-    });
-
-    // === OTA PAGE ===
-    server.on("/ota", HTTP_GET, [](AsyncWebServerRequest *request){
-        String page = R"rawliteral(
-<!DOCTYPE html>
-<html>
-<head>
-    <title>OTA Update</title>
-    <meta name="viewport" content="width=320,initial-scale=1">
-    <style>
-        body {background:#111;color:#EEE;font-family:sans-serif;}
-        .container {max-width:360px;margin:24px auto;background:#222;padding:2em;border-radius:12px;box-shadow:0 0 16px #0008;}
-        input[type=file],button {width:100%;box-sizing:border-box;margin:.7em 0;padding:.6em;font-size:1.05em;border-radius:8px;border:1px solid #555;background:#111;color:#EEE;}
-        .btn {background:#265aa5;color:white;border-color:#265aa5;}
-        .status {margin-top:1em;font-size:.95em;}
-        .barWrap {background:#111;border:1px solid #555;border-radius:8px;overflow:hidden;height:16px;margin-top:.5em}
-        .bar {height:100%;width:0%;}
-    </style>
-</head>
-<body>
-    <div class="container">
-        <h2>OTA Update</h2>
-        <input id="fw" type="file" accept=".bin">
-        <button class="btn" onclick="doUpload()">Upload & Flash</button>
-        <div class="barWrap"><div id="bar" class="bar"></div></div>
-        <div id="pct" class="status">0%</div>
-        <div id="otaStatus" class="status"></div>
-        <div class="row">
-            <button class="btn" onclick="window.location='/'" style="margin-top:14px;">Back to WiFi Setup</button>
-            <button class="btn" onclick="fetch('/reboot',{method:'POST'}).then(()=>{document.getElementById('otaStatus').innerText='Rebooting...';})" style="margin-top:14px;">Reboot Now</button>
-        </div>
-    </div>
-    <script>
-        function doUpload(){
-            const f = document.getElementById('fw').files[0];
-            if(!f){ alert('Choose a .bin first'); return; }
-            const xhr = new XMLHttpRequest();
-            xhr.open('POST','/update',true);
-            xhr.upload.onprogress = (e)=>{
-                if(e.lengthComputable){
-                    const p = Math.round((e.loaded/e.total)*100);
-                    document.getElementById('bar').style.width = p + '%';
-                    document.getElementById('bar').style.background = p>=100 ? '#299a2c' : '#265aa5';
-                    document.getElementById('pct').innerText = p + '%';
-                }
-            };
-            xhr.onreadystatechange = ()=>{
-                if(xhr.readyState===4){
-                    if(xhr.status===200){
-                        document.getElementById('otaStatus').innerText = 'Upload complete. Flash OK.';
-                    } else {
-                        document.getElementById('otaStatus').innerText = 'Upload finished with status ' + xhr.status;
-                    }
-                }
-            };
-            const form = new FormData();
-            form.append('firmware', f, f.name);
-            xhr.send(form);
-        }
-    </script>
-</body>
-</html>
-        )rawliteral";
-        request->send(200, "text/html", page);
-    });
+    // Portal, OTA and /emu pages: gzip from flash (web/, script/build_web_assets.py)
+    WebAssets::begin(server);
 
     // === OTA FIRMWARE UPLOAD HANDLER (chunked) ===
     server.on("/update", HTTP_POST,
@@ -350,7 +176,8 @@ void startPortal() {
     server.on("/status", HTTP_GET, [](AsyncWebServerRequest *request){
         String stat;
         if (WiFi.status() == WL_CONNECTED)
-            stat = "Connected to " + WiFi.SSID() + " - IP: " + WiFi.localIP().toString();
+            stat = "Connected to " + WiFi.SSID() + " - IP: " + WiFi.localIP().toString() +
+                   " - link: " + NetEgress::getRateState().name;
         else if (state == State::CONNECTING)
             stat = "Connecting to " + ssid + "...";
         else
@@ -456,6 +283,147 @@ void startPortal() {
         String j = String("{\"enabled\":") + (en ? "true" : "false") + "}";
         request->send(200, "application/json", j);
     });
+    server.on("/lcd/stats", HTTP_GET, [](AsyncWebServerRequest *request){
+        const LCDMonitor::CaptureStats cs = LCDMonitor::getCaptureStats();
+        const LCDMonitor::FramingStats fs = LCDMonitor::getFramingStats();
+        const LCDMonitor::SnapshotStats ss = LCDMonitor::getSnapshotStats();
+        const DLog::Stats ls = DLog::getStats();
+        const NetEgress::Stats es = NetEgress::getStats();
+        const NetEgress::RateState rs = NetEgress::getRateState();
+        const FrameCache::Stats js = FrameCache::getStats();
+        const WebEmu::StateStats ws = WebEmu::getStateStats();
+        const WebEmu::WsStats wss = WebEmu::getWsStats();
+        const WebEmu::SseStats sss = WebEmu::getSseStats();
+        char sse_clients[WEB_EMU_SSE_MAX_CLIENTS * 80 + 1] = "";
+        size_t n = 0;
+        for (uint8_t i = 0; i < sss.count && n < sizeof(sse_clients); ++i) {
+            const WebEmu::SseStats::Client& c = sss.clients[i];
+            n += snprintf(sse_clients + n, sizeof(sse_clients) - n,
+                          "%s{\"id\":%u,\"queue\":%u,\"sent\":%u,\"dropped\":%u,\"owed\":%s}",
+                          i ? "," : "", (unsigned)c.id, (unsigned)c.queue, (unsigned)c.sent,
+                          (unsigned)c.dropped, c.owed ? "true" : "false");
+        }
+        char j[2560];
+        snprintf(j, sizeof(j),
+                 "{\"id\":\"%s\",\"capture\":{\"captured\":%u,\"decoded\":%u,\"dropped\":%u,\"high_water\":%u,\"capacity\":%u},"
+                 "\"framing\":{\"paired_cmd\":%u,\"paired_data\":%u,\"stream_cmd\":%u,\"stream_data\":%u,"
+                 "\"control\":%u,\"reserved_control\":%u,\"lone_control\":%u},"
+                 "\"snapshot\":{\"reads\":%u,\"retries\":%u,\"max_retries\":%u},"
+                 "\"log\":{\"written\":%u,\"dropped\":%u,\"high_water\":%u,\"capacity\":%u},"
+                 "\"egress\":{\"wakeups\":%u,\"udp_sent\":%u,\"sse_sent\":%u,\"forced\":%u,"
+                 "\"sent_quiet\":%u,\"sent_stale\":%u,\"latency_last_ms\":%u,\"latency_max_ms\":%u,"
+                 "\"subscribers\":%u,\"bin_peers\":%u,\"joins\":%u,\"leaves\":%u,\"expired\":%u,"
+                 "\"ctrl_rx\":%u,\"rx_ignored\":%u,\"rx_self\":%u,\"rx_mirror\":%u,"
+                 "\"bcast_sent\":%u,\"mcast_sent\":%u,\"mcast_errors\":%u,"
+                 "\"json_unicast\":%u,\"bin_sent\":%u,"
+                 "\"key_sent\":%u,\"delta_sent\":%u,\"bin_bytes\":%u,\"keyreq_rx\":%u,\"shift_rows\":%u,"
+                 "\"dict_rows\":%u,\"fec_sent\":%u,\"send_errors\":%u,\"espnow_up\":%s,\"espnow_dropped\":%u},"
+                 "\"rate\":{\"enabled\":%s,\"level\":%u,\"name\":\"%s\",\"congested\":%s,\"rssi\":%d,"
+                 "\"fail_pct\":%u,\"loss_pct\":%d,\"keyreqs\":%u,\"min\":%u,\"key\":%u,\"fec\":%u,\"changes\":%u},"
+                 "\"json\":{\"encoded\":%u,\"reused\":%u},"
+                 "\"state\":{\"full\":%u,\"not_modified\":%u,\"parked\":%u,\"woken\":%u,"
+                 "\"expired\":%u,\"rejected\":%u,\"waiting\":%u},"
+                 "\"ws\":{\"clients\":%u,\"full\":%u,\"delta\":%u,\"bytes\":%u,\"keyreq\":%u},"
+                 "\"sse\":{\"full\":%u,\"delta\":%u,\"resumed\":%u,\"resync\":%u,"
+                 "\"evicted\":%u,\"rejected\":%u,\"clients\":[%s]}}",
+                 NetEgress::deviceId(), (unsigned)cs.captured, (unsigned)cs.decoded, (unsigned)cs.dropped,
+                 (unsigned)cs.high_water, (unsigned)cs.capacity,
+                 (unsigned)fs.paired_cmd, (unsigned)fs.paired_data, (unsigned)fs.stream_cmd, (unsigned)fs.stream_data,
+                 (unsigned)fs.control_bytes, (unsigned)fs.reserved_control, (unsigned)fs.lone_control,
+                 (unsigned)ss.reads, (unsigned)ss.retries, (unsigned)ss.max_retries,
+                 (unsigned)ls.written, (unsigned)ls.dropped, (unsigned)ls.high_water, (unsigned)ls.capacity,
+                 (unsigned)es.wakeups, (unsigned)es.udp_sent, (unsigned)es.sse_sent, (unsigned)es.forced,
+                 (unsigned)es.sent_quiet, (unsigned)es.sent_stale, (unsigned)es.latency_last_ms, (unsigned)es.latency_max_ms,
+                 (unsigned)es.subscribers, (unsigned)es.bin_peers, (unsigned)es.joins, (unsigned)es.leaves,
+                 (unsigned)es.expired, (unsigned)es.ctrl_rx, (unsigned)es.rx_ignored,
+                 (unsigned)es.rx_self, (unsigned)es.rx_mirror, (unsigned)es.bcast_sent,
+                 (unsigned)es.mcast_sent, (unsigned)es.mcast_errors, (unsigned)es.json_unicast, (unsigned)es.bin_sent,
+                 (unsigned)es.key_sent, (unsigned)es.delta_sent, (unsigned)es.bin_bytes, (unsigned)es.keyreq_rx,
+                 (unsigned)es.shift_rows, (unsigned)es.dict_rows, (unsigned)es.fec_sent, (unsigned)es.send_errors,
+                 es.espnow_up ? "true" : "false", (unsigned)es.espnow_dropped,
+                 rs.enabled ? "true" : "false", (unsigned)rs.level, rs.name, rs.congested ? "true" : "false",
+                 (int)rs.rssi, (unsigned)rs.fail_pct, rs.loss_pct == 0xFF ? -1 : (int)rs.loss_pct,
+                 (unsigned)rs.keyreqs, (unsigned)rs.min_interval_ms, (unsigned)rs.keyframe_ms,
+                 (unsigned)rs.fec_repeat_ms, (unsigned)rs.changes,
+                 (unsigned)js.encoded, (unsigned)js.reused,
+                 (unsigned)ws.full, (unsigned)ws.not_modified, (unsigned)ws.parked, (unsigned)ws.woken,
+                 (unsigned)ws.expired, (unsigned)ws.rejected, (unsigned)ws.waiting,
+                 (unsigned)wss.clients, (unsigned)wss.full, (unsigned)wss.delta, (unsigned)wss.bytes,
+                 (unsigned)wss.keyreq,
+                 (unsigned)sss.full, (unsigned)sss.delta, (unsigned)sss.resumed, (unsigned)sss.resync,
+                 (unsigned)sss.evicted, (unsigned)sss.rejected, sse_clients);
+        request->send(200, "application/json", j);
+    });
+    // Frame scheduler timings: /lcd/schedule?quiet=8&min=50&stale=250&key=2000&fec=0&adapt=1
+    // (any subset; not persisted). Out-of-range values get a 400 and change nothing.
+    server.on("/lcd/schedule", HTTP_ANY, [](AsyncWebServerRequest *request){
+        NetEgress::Schedule sch = NetEgress::getSchedule();
+        long quiet = sch.quiet_ms, min_ms = sch.min_interval_ms, stale = sch.max_stale_ms;
+        long key = sch.keyframe_ms, fec = sch.fec_repeat_ms, adapt = sch.adaptive ? 1 : 0;
+        if (!intParam(request, "quiet", 0, 1000, quiet) ||
+            !intParam(request, "min", 10, 10000, min_ms) ||
+            !intParam(request, "stale", 10, 10000, stale) ||
+            !intParam(request, "key", 100, 60000, key) ||
+            !intParam(request, "fec", 0, 1000, fec) ||
+            !intParam(request, "adapt", 0, 1, adapt)) {
+            return;
+        }
+        sch.quiet_ms = (uint16_t)quiet;
+        sch.min_interval_ms = (uint16_t)min_ms;
+        sch.max_stale_ms = (uint16_t)stale;
+        sch.keyframe_ms = (uint16_t)key;
+        sch.fec_repeat_ms = (uint16_t)fec;
+        sch.adaptive = adapt != 0;
+        NetEgress::setSchedule(sch);
+        char j[144];
+        snprintf(j, sizeof(j), "{\"quiet\":%u,\"min\":%u,\"stale\":%u,\"key\":%u,\"fec\":%u,\"adapt\":%s}",
+                 (unsigned)sch.quiet_ms, (unsigned)sch.min_interval_ms, (unsigned)sch.max_stale_ms,
+                 (unsigned)sch.keyframe_ms, (unsigned)sch.fec_repeat_ms, sch.adaptive ? "true" : "false");
+        request->send(200, "application/json", j);
+    });
+    // Group transport: /lcd/transport?mode=multicast&group=239.255.76.67&ttl=1&rate=24&espnow=1
+    // (any subset; mode=broadcast|multicast, rate in Mbit/s, 0 = driver default; a pinned rate
+    // covers all station traffic, this page and OTA included). Persisted. A bad value gets a 400
+    // and changes nothing.
+    server.on("/lcd/transport", HTTP_ANY, [](AsyncWebServerRequest *request){
+        NetEgress::Transport t = NetEgress::getTransport();
+        if (request->hasParam("mode")) {
+            const String& mode = request->getParam("mode")->value();
+            if (mode != "broadcast" && mode != "multicast") {
+                request->send(400, "text/plain", "mode must be broadcast or multicast");
+                return;
+            }
+            t.multicast = mode == "multicast";
+        }
+        if (request->hasParam("group")) {
+            IPAddress group;
+            if (!group.fromString(request->getParam("group")->value()) || group[0] < 224 || group[0] > 239) {
+                request->send(400, "text/plain", "group must be an IPv4 multicast address");
+                return;
+            }
+            for (int i = 0; i < 4; i++) t.group[i] = group[i];
+        }
+        long ttl = t.ttl, rate = t.phy_rate_mbps, espnow = t.espnow ? 1 : 0;
+        if (!intParam(request, "ttl", 1, 255, ttl) ||
+            !intParam(request, "rate", 0, 54, rate) ||
+            !intParam(request, "espnow", 0, 1, espnow)) {
+            return;
+        }
+        if (!NetEgress::validPhyRate((uint8_t)rate)) {
+            request->send(400, "text/plain", "rate must be 0, 1, 2, 5, 11, 6, 9, 12, 18, 24, 36, 48 or 54");
+            return;
+        }
+        t.ttl = (uint8_t)ttl;
+        t.phy_rate_mbps = (uint8_t)rate;
+        t.espnow = espnow != 0;
+        NetEgress::setTransport(t);
+        saveTransport(t);
+        char j[144];
+        snprintf(j, sizeof(j), "{\"mode\":\"%s\",\"group\":\"%u.%u.%u.%u\",\"ttl\":%u,\"rate\":%u,\"espnow\":%s}",
+                 t.multicast ? "multicast" : "broadcast", t.group[0], t.group[1], t.group[2], t.group[3],
+                 (unsigned)t.ttl, (unsigned)t.phy_rate_mbps, t.espnow ? "true" : "false");
+        request->send(200, "application/json", j);
+    });
     server.on("/lcd/enable", HTTP_ANY, [](AsyncWebServerRequest *request){
         LCDMonitor::setEmulatorEnabled(true);
         request->send(200, "text/plain", "LCD emulator enabled");
@@ -505,6 +473,7 @@ void tryConnect() {
 void begin() {
     LedStat::setStatus(LedStatus::Booting);
     loadCreds();
+    loadTransport();
     startPortal();
     if (ssid.length() > 0)
         tryConnect();